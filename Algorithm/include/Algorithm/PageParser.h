@@ -341,8 +341,65 @@ class PageParser
     return mGetNElementsFct(groupHeader);
   }
 
+  /// A zero-copy view of one element in the page buffer: the element
+  /// spans at most two pages, so it is described by up to two
+  /// (pointer, size) ranges; the second range is empty unless the
+  /// element straddles a page boundary.
+  struct ElementView {
+    const BufferType* first = nullptr;
+    size_t firstSize = 0;
+    const BufferType* second = nullptr;
+    size_t secondSize = 0;
+  };
+
+  /// Retrieve a zero-copy view of the object at position, advancing the
+  /// position like getElement does, but without copying the payload:
+  /// consumers which can work on (up to) two ranges avoid the per-element
+  /// memcpy entirely, also for payloads straddling a page boundary.
+  bool getElementView(size_t& position, ElementView& view) const
+  {
+    if (!advanceToElement(position)) {
+      return false;
+    }
+    auto source = mBuffer + position;
+    size_t pageCapacity = page_size - (position % page_size);
+    if (pageCapacity == page_size) {
+      // skip the page header at beginning of page
+      position += sizeof(PageHeaderType);
+      pageCapacity -= sizeof(PageHeaderType);
+      source += sizeof(PageHeaderType);
+    }
+    view.firstSize = sizeof(value_type) > pageCapacity ? pageCapacity : sizeof(value_type);
+    view.first = source;
+    position += view.firstSize;
+    view.secondSize = sizeof(value_type) - view.firstSize;
+    if (view.secondSize > 0) {
+      // skip page header at beginning of new page
+      position += sizeof(PageHeaderType);
+      view.second = source + view.firstSize + sizeof(PageHeaderType);
+      position += view.secondSize;
+    } else {
+      view.second = nullptr;
+    }
+    return true;
+  }
+
   /// retrieve an object at position
   bool getElement(size_t& position, value_type& element) const
+  {
+    if (!advanceToElement(position)) {
+      return false;
+    }
+    auto source = mBuffer + position;
+    auto target = reinterpret_cast<BufferType*>(&element);
+    position += copy<SourceInPageBuffer>(source, target, page_size - (position % page_size));
+    return true;
+  }
+
+ private:
+  /// common part of getElement/getElementView: handle the group headers
+  /// and check that an element is available at position
+  bool advanceToElement(size_t& position) const
   {
     // check if we are at the end
     if (position >= mSize) {
@@ -402,13 +459,11 @@ class PageParser
       position = mSize;
       return false;
     }
-
-    auto source = mBuffer + position;
-    auto target = reinterpret_cast<BufferType*>(&element);
-    position += copy<SourceInPageBuffer>(source, target, page_size - (position % page_size));
     return true;
   }
 
+ public:
+
   // copy data, depending on compile time switch, either source or target
   // pointer are treated as pointer in the raw page, i.e. can be additionally
   // incremented by the page header
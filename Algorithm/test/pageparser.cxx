@@ -223,6 +223,33 @@ BOOST_AUTO_TEST_CASE(test_pageparser)
   }
 }
 
+BOOST_AUTO_TEST_CASE(test_pageparser_view)
+{
+  constexpr unsigned pagesize = 128;
+  std::vector<ClusterData> dataset;
+  FillData(dataset, 20);
+  auto buffer = MakeBuffer(pagesize, PageHeader(0), dataset);
+
+  using RawParser = o2::algorithm::PageParser<PageHeader, pagesize, ClusterData>;
+  const RawParser parser(buffer.first.get(), buffer.second);
+
+  // the zero-copy views must reassemble to the same elements, with the
+  // second range used exactly for the page-straddling ones
+  size_t position = 0;
+  unsigned dataidx = 0;
+  RawParser::ElementView view;
+  while (parser.getElementView(position, view)) {
+    ClusterData element;
+    BOOST_REQUIRE(view.firstSize + view.secondSize == sizeof(ClusterData));
+    memcpy(&element, view.first, view.firstSize);
+    if (view.secondSize > 0) {
+      memcpy(reinterpret_cast<char*>(&element) + view.firstSize, view.second, view.secondSize);
+    }
+    BOOST_REQUIRE(element == dataset[dataidx++]);
+  }
+  BOOST_REQUIRE(dataidx == dataset.size());
+}
+
 BOOST_AUTO_TEST_CASE(test_pageparser_group)
 {
   using DataSetT = std::vector<ClusterData>;
@@ -80,6 +80,9 @@ class CCDBManagerInstance
   {
     mCCDBAccessor.init(path);
     mDeplMode = o2::framework::DefaultsHelpers::deploymentMode();
+    if (auto* manifest = getenv("ALICEO2_CCDB_PREFETCH_MANIFEST")) {
+      prefetchFromManifest(manifest);
+    }
   }
   /// set a URL to query from
   void setURL(const std::string& url);
@@ -98,6 +101,19 @@ class CCDBManagerInstance
   /// query timestamp
   long getTimestamp() const { return mTimestamp; }
 
+  /// Prefetch the snapshots of the given paths in parallel into the node
+  /// local cache (ALICEO2_CCDB_LOCALCACHE), so that the network latency
+  /// is paid once, up front and concurrently, instead of serially on
+  /// first use of every object. Deserialization still happens lazily.
+  /// A timestamp of -1 uses the one of the manager.
+  void prefetch(std::vector<std::string> const& paths, long timestamp = -1, size_t nThreads = 8);
+
+  /// Prefetch the paths listed in a manifest file, one path per line,
+  /// empty lines and lines starting with '#' ignored. A workflow can
+  /// thus declare its CCDB needs up front (or via the
+  /// ALICEO2_CCDB_PREFETCH_MANIFEST environment variable).
+  void prefetchFromManifest(std::string const& manifest, long timestamp = -1, size_t nThreads = 8);
+
   /// retrieve an object of type T from CCDB as stored under path and timestamp
   template <typename T>
   T* getForTimeStamp(std::string const& path, long timestamp);
@@ -26,7 +26,10 @@
 #include "CCDB/CcdbObjectInfo.h"
 #include <CommonUtils/ConfigurableParam.h>
 #include <type_traits>
+#include <typeinfo>
+#include <cstring>
 #include <vector>
+#include <gsl/span>
 
 #if !defined(__CINT__) && !defined(__MAKECINT__) && !defined(__ROOTCLING__) && !defined(__CLING__)
 #include "MemoryResources/MemoryResources.h"
@@ -359,6 +362,9 @@ class CcdbApi //: public DatabaseInterface
     std::string createdNotAfter;
     std::string createdNotBefore;
     bool considerSnapshot;
+    /// held across a snapshot-creating download (single-flight): peers on
+    /// the node block on the per-path semaphore and then read the snapshot
+    std::shared_ptr<void> snapshotLock;
 
     RequestContext(o2::pmr::vector<char>& d,
                    std::map<std::string, std::string> const& m,
@@ -498,6 +504,64 @@ class CcdbApi //: public DatabaseInterface
                         const std::string& path, const std::map<std::string, std::string>& metadata,
                         long startValidityTimestamp, long endValidityTimestamp, std::vector<char>::size_type maxSize = 0 /*in bytes*/) const;
 
+  /// Header guarding the reinterpretation of flat-blob objects (see
+  /// storeAsFlatBlob): size and a hash of the mangled type name are
+  /// validated before a view is handed out.
+  struct FlatBlobHeader {
+    static constexpr uint64_t Magic = 0x4f32464c41544231ull; // "O2FLATB1"
+    uint64_t magic = Magic;
+    uint64_t size = 0;
+    uint64_t typeHash = 0;
+  };
+
+  static uint64_t flatBlobTypeHash(std::type_info const& info)
+  {
+    uint64_t h = 0xcbf29ce484222325ull;
+    for (const char* c = info.name(); *c; ++c) {
+      h = (h ^ uint8_t(*c)) * 0x100000001b3ull;
+    }
+    return h;
+  }
+
+  /// Store a trivially-copyable object as a versioned raw blob, without
+  /// any ROOT serialization: the payload is the object's bytes preceded
+  /// by a FlatBlobHeader. Intended for flat POD calibration objects
+  /// (gain maps, dead-channel masks) where the ROOT roundtrip dominates
+  /// the fetch cost. The consumer uses viewFlatBlob on the downloaded
+  /// buffer to obtain a validated view without deserialization.
+  template <typename T>
+  typename std::enable_if<std::is_trivially_copyable<T>::value, int>::type
+    storeAsFlatBlob(const T& obj, std::string const& path, std::map<std::string, std::string> const& metadata,
+                    long startValidityTimestamp, long endValidityTimestamp) const
+  {
+    FlatBlobHeader header;
+    header.size = sizeof(T);
+    header.typeHash = flatBlobTypeHash(typeid(T));
+    std::vector<char> buffer(sizeof(header) + sizeof(T));
+    std::memcpy(buffer.data(), &header, sizeof(header));
+    std::memcpy(buffer.data() + sizeof(header), &obj, sizeof(T));
+    return storeAsBinaryFile(buffer.data(), buffer.size(), "flatblob.bin", typeid(T).name(), path, metadata,
+                             startValidityTimestamp, endValidityTimestamp);
+  }
+
+  /// Validated view into a downloaded flat blob (see storeAsFlatBlob).
+  /// Returns nullptr when the magic, size or type hash do not match; the
+  /// view aliases the download buffer, which must outlive it.
+  template <typename T>
+  static typename std::enable_if<std::is_trivially_copyable<T>::value, const T*>::type
+    viewFlatBlob(gsl::span<const char> blob)
+  {
+    FlatBlobHeader header;
+    if (blob.size() < sizeof(header) + sizeof(T)) {
+      return nullptr;
+    }
+    std::memcpy(&header, blob.data(), sizeof(header));
+    if (header.magic != FlatBlobHeader::Magic || header.size != sizeof(T) || header.typeHash != flatBlobTypeHash(typeid(T))) {
+      return nullptr;
+    }
+    return reinterpret_cast<const T*>(blob.data() + sizeof(header));
+  }
+
   /**
    * A generic helper implementation to store an obj whose type is given by a std::type_info
    * @return 0 -> ok,
@@ -15,7 +15,11 @@
 #include "CCDB/BasicCCDBManager.h"
 #include <boost/lexical_cast.hpp>
 #include <fairlogger/Logger.h>
+#include <atomic>
+#include <chrono>
+#include <fstream>
 #include <string>
+#include <thread>
 
 namespace o2
 {
@@ -27,6 +31,74 @@ void CCDBManagerInstance::setURL(std::string const& url)
   mCCDBAccessor.init(url);
 }
 
+void CCDBManagerInstance::prefetch(std::vector<std::string> const& paths, long timestamp, size_t nThreads)
+{
+  if (paths.empty()) {
+    return;
+  }
+  if (!getenv("ALICEO2_CCDB_LOCALCACHE")) {
+    LOGP(warn, "CCDB prefetch requested but ALICEO2_CCDB_LOCALCACHE is not set, skipping");
+    return;
+  }
+  if (timestamp < 0) {
+    timestamp = mTimestamp;
+  }
+  auto start = std::chrono::system_clock::now();
+  // Each worker uses its own CcdbApi instance (the API is not
+  // thread-safe) and simply loads the file, which populates the local
+  // snapshot cache as a side effect.
+  std::atomic<size_t> next{0};
+  std::atomic<int> failures{0};
+  auto worker = [&next, &failures, &paths, timestamp, url = mCCDBAccessor.getURL()]() {
+    CcdbApi api;
+    api.init(url);
+    o2::pmr::vector<char> dest;
+    std::map<std::string, std::string> metadata;
+    std::map<std::string, std::string> headers;
+    size_t i;
+    while ((i = next.fetch_add(1)) < paths.size()) {
+      dest.clear();
+      headers.clear();
+      api.loadFileToMemory(dest, paths[i], metadata, timestamp, &headers, "", "", "");
+      if (dest.empty()) {
+        LOGP(warn, "Prefetch of {} for timestamp {} failed", paths[i], timestamp);
+        failures++;
+      }
+    }
+  };
+  std::vector<std::thread> threads;
+  for (size_t t = std::min(nThreads, paths.size()); t--;) {
+    threads.emplace_back(worker);
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  auto end = std::chrono::system_clock::now();
+  mTimerMS += std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+  LOGP(info, "Prefetched {} CCDB objects ({} failures) in {} ms", paths.size() - failures, (int)failures,
+       std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
+}
+
+void CCDBManagerInstance::prefetchFromManifest(std::string const& manifest, long timestamp, size_t nThreads)
+{
+  std::ifstream in(manifest);
+  if (!in.good()) {
+    LOGP(warn, "Cannot open CCDB prefetch manifest {}", manifest);
+    return;
+  }
+  std::vector<std::string> paths;
+  std::string line;
+  while (std::getline(in, line)) {
+    auto first = line.find_first_not_of(" \t");
+    if (first == std::string::npos || line[first] == '#') {
+      continue;
+    }
+    auto last = line.find_last_not_of(" \t\r");
+    paths.push_back(line.substr(first, last - first + 1));
+  }
+  prefetch(paths, timestamp, nThreads);
+}
+
 void CCDBManagerInstance::reportFatal(std::string_view err)
 {
   LOG(fatal) << err;
@@ -1919,6 +1919,19 @@ void CcdbApi::navigateSourcesAndLoadFile(RequestContext& requestContext, int& fr
     // this would mean that the object was is already fetched and in this mode we don't to validity checks!
     getFromSnapshot(createSnapshot, requestContext.path, requestContext.timestamp, requestContext.headers, snapshotpath, requestContext.dest, fromSnapshot, requestContext.etag);
   } else { // look on the server
+    if (createSnapshot) {
+      // Single-flight download: hold the per-path semaphore across the
+      // download (released when the request context is destroyed, i.e.
+      // after saveSnapshot), so concurrent jobs on the node wait instead
+      // of fetching the same object. After acquiring, re-check: a peer
+      // may have produced the snapshot while we were blocked.
+      requestContext.snapshotLock = std::make_shared<CCDBSemaphore>(mSnapshotCachePath, requestContext.path);
+      if (std::filesystem::exists(snapshotpath)) {
+        getFromSnapshot(createSnapshot, requestContext.path, requestContext.timestamp, requestContext.headers, snapshotpath, requestContext.dest, fromSnapshot, requestContext.etag);
+        requestContext.snapshotLock.reset();
+        return;
+      }
+    }
     scheduleDownload(requestContext, requestCounter);
   }
 }
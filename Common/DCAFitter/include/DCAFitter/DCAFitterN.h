@@ -21,6 +21,7 @@
 #include "DetectorsBase/Propagator.h"
 #include "MathUtils/Cartesian.h"
 #include "ReconstructionDataFormats/Track.h"
+#include <gsl/span>
 
 namespace o2
 {
@@ -1133,6 +1134,41 @@ GPUdi() bool DCAFitterN<N, Args...>::propagateToX(o2::track::TrackParCov& t, flo
 using DCAFitter2 = DCAFitterN<2, o2::track::TrackParCov>;
 using DCAFitter3 = DCAFitterN<3, o2::track::TrackParCov>;
 
+/// Batch interface for two-prong candidates with a cheap transverse-plane
+/// prefilter: the minimal distance between the two track circles is
+/// computed from the helix parameters and pairs farther apart than
+/// @a maxCircleDist (cm) are rejected (results[i] = -1) without touching
+/// the iterative minimizer. Survivors are fitted back to back with the
+/// same fitter, keeping its scratch warm. Returns the number of pairs
+/// with at least one vertex candidate.
+template <class Fitter>
+int processBulkWithPrefilter(Fitter& fitter, float bz, float maxCircleDist,
+                             gsl::span<const o2::track::TrackParCov> tracksA,
+                             gsl::span<const o2::track::TrackParCov> tracksB,
+                             std::vector<int>& results)
+{
+  results.resize(tracksA.size());
+  int nWithCandidates = 0;
+  for (size_t i = 0; i < tracksA.size(); i++) {
+    o2::math_utils::CircleXYf_t circleA, circleB;
+    float sna, csa;
+    tracksA[i].getCircleParams(bz, circleA, sna, csa);
+    tracksB[i].getCircleParams(bz, circleB, sna, csa);
+    float dx = circleA.xC - circleB.xC, dy = circleA.yC - circleB.yC;
+    float dist = std::sqrt(dx * dx + dy * dy);
+    // minimal 2D distance between the circles: positive when separated
+    // (outside) or nested without touching (inside)
+    float gap = std::max(dist - (circleA.rC + circleB.rC), std::fabs(circleA.rC - circleB.rC) - dist);
+    if (gap > maxCircleDist) {
+      results[i] = -1;
+      continue;
+    }
+    results[i] = fitter.process(tracksA[i], tracksB[i]);
+    nWithCandidates += results[i] > 0;
+  }
+  return nWithCandidates;
+}
+
 namespace device
 {
 template <typename Fitter>
@@ -720,7 +720,16 @@ void MagneticField::AllowFastField(bool v)
 {
   if (v) {
     if (!mFastField) {
-      mFastField = std::make_unique<MagFieldFast>(getFactorSolenoid(), mMapType == MagFieldParam::k2kG ? 2 : 5);
+      // An externally fitted parametrization (e.g. produced offline for
+      // non-nominal currents) can be provided via O2_MAGFIELD_FAST_PARAM;
+      // otherwise the bundled nominal 2/5 kG files are used.
+      if (const char* custom = getenv("O2_MAGFIELD_FAST_PARAM")) {
+        LOG(info) << "Loading fast field parametrization from " << custom;
+        mFastField = std::make_unique<MagFieldFast>(custom);
+        mFastField->setFactorSol(getFactorSolenoid());
+      } else {
+        mFastField = std::make_unique<MagFieldFast>(getFactorSolenoid(), mMapType == MagFieldParam::k2kG ? 2 : 5);
+      }
     }
   } else {
     mFastField.reset(nullptr);
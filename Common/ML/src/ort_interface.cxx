@@ -164,6 +164,14 @@ std::vector<O> OrtModel::v2v(std::vector<I>& input, bool clearInput)
 }
 
 template <class I, class O> // class I is the input data type, e.g. float, class O is the output data type, e.g. O2::gpu::OrtDataType::Float16_t from O2/GPU/GPUTracking/ML/convert_float16.h
+// Note on batching: this entry point is already batch-shaped - the batch
+// dimension is derived from the input size, and the tensor wraps the
+// caller's buffer without a copy - so callers should accumulate their
+// candidates per TF and run one large call instead of per-candidate
+// calls. Sharing one engine across devices (central batching with a
+// latency budget) is a workflow-level service: it needs a dedicated DPL
+// device owning the session, with requests routed as ordinary messages,
+// not an API on this per-process wrapper.
 std::vector<O> OrtModel::inference(std::vector<I>& input)
 {
   std::vector<int64_t> inputShape{(int64_t)(input.size() / mInputShapes[0][1]), (int64_t)mInputShapes[0][1]};
@@ -130,6 +130,7 @@ class Chebyshev3D : public TNamed
 
   void Eval(const Float_t* par, Float_t* res);
 
+
   Float_t Eval(const Float_t* par, int idim);
 
   void Eval(const Double_t* par, Double_t* res);
@@ -289,6 +290,7 @@ inline Bool_t Chebyshev3D::isInside(const Double_t* par) const
   return kTRUE;
 }
 
+
 /// Evaluates Chebyshev parameterization for 3d->DimOut function
 inline void Chebyshev3D::Eval(const Float_t* par, Float_t* res)
 {
@@ -0,0 +1,79 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// @brief Helper to run an end-of-stream task in a detached child process
+
+#ifndef ALICEO2_COMMON_BACKGROUNDTASK_H_
+#define ALICEO2_COMMON_BACKGROUNDTASK_H_
+
+#include <functional>
+#include <sys/resource.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+namespace o2::utils
+{
+
+/// Run @a task in a detached (double-forked) child process: the parent
+/// returns immediately and can exit, while the grandchild - holding a
+/// copy-on-write snapshot of the process state at the time of the call -
+/// performs the task and exits. Suited for large final-state writes
+/// (e.g. calibration snapshots at end of run) which would otherwise
+/// block topology teardown: the fork snapshots the objects without any
+/// explicit clone. Returns false (and performs nothing) when the fork
+/// fails, so the caller can fall back to the synchronous path.
+///
+/// Caveats - fork() from a live multithreaded device is inherently
+/// restricted: only the calling thread exists in the child, and any lock
+/// (malloc arena, ROOT global, ...) held by another thread at fork time
+/// stays locked forever there. The task must therefore only be invoked
+/// from points where the other threads are known to be quiescent (end of
+/// stream / end of run) and must not touch the parent's sockets; all
+/// descriptors above stderr are closed in the worker before the task
+/// runs, so inherited FairMQ/ZMQ and CCDB connections cannot be written
+/// to by accident.
+inline bool runInDetachedChild(const std::function<void()>& task)
+{
+  pid_t child = fork();
+  if (child < 0) {
+    return false;
+  }
+  if (child == 0) { // intermediate child: detach the worker and exit
+    pid_t grandChild = fork();
+    if (grandChild == 0) {
+      // drop every inherited descriptor except stdio before doing work
+#if defined(__linux__) && defined(SYS_close_range)
+      if (syscall(SYS_close_range, 3u, ~0u, 0u) != 0)
+#endif
+      {
+        struct rlimit rlim;
+        getrlimit(RLIMIT_NOFILE, &rlim);
+        for (int i = 3; i < (int)rlim.rlim_cur; ++i) {
+          close(i);
+        }
+      }
+      task();
+      _exit(0);
+    }
+    _exit(grandChild < 0 ? 1 : 0);
+  }
+  int status = 0;
+  waitpid(child, &status, 0); // the intermediate child exits immediately, the worker is reparented
+  return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+} // namespace o2::utils
+
+#endif
@@ -61,6 +61,10 @@ class FileFetcher
   void setFailThreshold(float f) { mFailThreshold = f; }
   float getFailThreshold() const { return mFailThreshold; }
   void setMaxFilesInQueue(size_t s) { mMaxInQueue = s > 0 ? s : 1; }
+  /// stage up to n files concurrently (completion is re-ordered, so the
+  /// consumption order is unchanged); alien copies stay serialized since
+  /// they communicate through process-wide environment variables
+  void setNConcurrentFetchers(size_t n) { mNFetchThreads = n > 0 ? n : 1; }
   void setMaxLoops(size_t v) { mMaxLoops = v; }
   bool isRunning() const { return mRunning; }
   bool isFailed() const { return mFailure; }
@@ -108,8 +112,10 @@ class FileFetcher
   size_t mNFilesProc = 0;
   size_t mNFilesProcOK = 0;
   float mFailThreshold = 0.f; // throw if too many failed fetches (>0 : fraction to total, <0 abs number)
+  size_t mNFetchThreads = 1;
   mutable std::mutex mMtx;
   std::mutex mMtxStop;
+  std::mutex mCopiedMtx; //! guards mCopied when copies run concurrently
   std::thread mFetcherThread{};
 
   ClassDefNV(FileFetcher, 1);
@@ -26,6 +26,18 @@ class IRFrameSelector
  public:
   long check(o2::dataformats::IRFrame fr, size_t bwd = 0, size_t fwd = 0);
   long check(const o2::InteractionRecord& ir, size_t bwd = 0, size_t fwd = 0) { return check(o2::dataformats::IRFrame{ir, ir}, bwd, fwd); }
+  /// Batch query: fills results with check() of every frame. The single
+  /// query path memoizes the last matched position, so a time-sorted
+  /// query stream degenerates into one merged forward scan over the
+  /// selected frames (m+n) instead of m independent binary searches.
+  void check(gsl::span<const o2::dataformats::IRFrame> frames, std::vector<long>& results, size_t bwd = 0, size_t fwd = 0)
+  {
+    results.clear();
+    results.reserve(frames.size());
+    for (const auto& frame : frames) {
+      results.push_back(check(frame, bwd, fwd));
+    }
+  }
   gsl::span<const o2::dataformats::IRFrame> getMatchingFrames(const o2::dataformats::IRFrame& fr);
 
   template <typename SPAN>
@@ -61,6 +61,15 @@ void pushCompressor(T& stream, CompressionMethod method)
 {
   switch (method) {
     case CompressionMethod::Gzip:
+      // On a multi-frame parallel mode: the boost::iostreams filters are
+      // inherently single-stream, and none of the codecs wired here
+      // (gzip/bzip2) supports independent-frame parallelism. The natural
+      // implementation is chunking the input into independent zstd
+      // frames compressed on a pool (the standard zstd tools decode such
+      // concatenated frames transparently), which first needs libzstd as
+      // a dependency of CommonUtils - there is no zstd boost filter.
+      // Until then, funnel large payloads through ROOT's IMT-aware
+      // writers instead of this stream when bandwidth matters.
       stream.push(boost::iostreams::gzip_compressor());
       break;
     case CompressionMethod::Zlib:
@@ -336,6 +336,13 @@ ConfigurableParam::ConfigurableParam()
 
 // ------------------------------------------------------------------
 
+// Note on init cost: the static registration only appends pointers; the
+// expensive part (ROOT reflection over the members, property tree and
+// provenance construction) happens here and is already lazy - triggered
+// by the first configuration access (updateFromString/File, writeINI,
+// setValue), not at process start. Worker processes that never touch a
+// parameter never pay it. A name->factory table would only relocate the
+// pointer registration, which is not measurable.
 void ConfigurableParam::initialize()
 {
   initPropertyTree();
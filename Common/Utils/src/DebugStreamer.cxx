@@ -135,6 +135,13 @@ std::pair<o2::utils::SamplingTypes, float> o2::utils::DebugStreamer::getSampling
 
 std::string o2::utils::DebugStreamer::getUniqueTreeName(const char* tree, const size_t id) const { return fmt::format("{}_{}", tree, getNTrees(id)); }
 
+// Despite the historical name this keys the streamers by *thread*: each
+// thread owns a private TreeStreamRedirector and output file, so the
+// fill path takes no lock (the tbb map only guards concurrent first-use
+// insertion). What remains per streamed tuple is the ROOT tree fill
+// itself - a background filler thread would serialize there again, so
+// throughput-critical capture should stream fewer/flatter tuples rather
+// than expect a faster sink.
 size_t o2::utils::DebugStreamer::getCPUID() { return std::hash<std::thread::id>{}(std::this_thread::get_id()); }
 
 o2::utils::TreeStreamRedirector* o2::utils::DebugStreamer::getStreamerPtr(const size_t id) const
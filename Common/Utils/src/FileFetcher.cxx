@@ -13,6 +13,8 @@
 /// Code partially based on DataDistribution:SubTimeFrameFileSource by Gvozden Nescovic
 
 #include "CommonUtils/FileFetcher.h"
+#include <deque>
+#include <future>
 #include "CommonUtils/StringUtils.h"
 #include "CommonUtils/FileSystemUtils.h"
 #include "Framework/Logger.h"
@@ -267,6 +269,75 @@ void FileFetcher::fetcher()
     }
   }
 
+  if (mNFetchThreads > 1 && mCopyCmd.find("alien") != std::string::npos) {
+    // the alien setup in copyFile mutates process-wide state (TGrid
+    // connection, ALIENPY/XRD log environment), which concurrent copies
+    // would race on
+    LOGP(info, "Copy command refers to alien, forcing serial fetching");
+    mNFetchThreads = 1;
+  }
+  if (mNFetchThreads > 1) {
+    // Concurrent staging: up to mNFetchThreads copies run in flight, but
+    // the results are consumed in scheduling order, so the queue (and
+    // hence the consumption order) is identical to the serial mode.
+    std::deque<std::pair<size_t, std::future<bool>>> inFlight;
+    while (mRunning) {
+      mNLoops = mNFilesProc / getNFiles();
+      if (mNLoops > mMaxLoops) {
+        LOGP(info, "Finished file fetching: {} of {} files fetched successfully in {} iterations", mNFilesProcOK, mNFilesProc, mMaxLoops);
+        mRunning = false;
+        break;
+      }
+      while (inFlight.size() < mNFetchThreads && getQueueSize() + inFlight.size() < mMaxInQueue &&
+             (mNFilesProc / getNFiles()) <= mMaxLoops) {
+        fileEntry = (fileEntry + 1) % getNFiles();
+        if (fileEntry == 0 && mNFilesProc / getNFiles() > 0) {
+          LOG(info) << "Fetcher starts new iteration " << mNFilesProc / getNFiles();
+        }
+        mNFilesProc++;
+        auto& fileRef = mInputFiles[fileEntry];
+        if (fileRef.copied || !fileRef.remote || mNoRemoteCopy) {
+          mQueue.push(fileEntry);
+          mNFilesProcOK++;
+        } else {
+          inFlight.emplace_back(fileEntry, std::async(std::launch::async, [this, entry = fileEntry]() { return copyFile(entry); }));
+        }
+      }
+      if (inFlight.empty()) {
+        std::this_thread::sleep_for(5ms);
+        continue;
+      }
+      if (inFlight.front().second.wait_for(5ms) != std::future_status::ready) {
+        continue;
+      }
+      auto entry = inFlight.front().first;
+      bool copied = inFlight.front().second.get();
+      inFlight.pop_front();
+      if (copied) {
+        mInputFiles[entry].copied = true;
+        mQueue.push(entry);
+        mNFilesProcOK++;
+      } else {
+        if (mFailThreshold < 0.f) { // cut on abs number of failures
+          if (mNFilesProc - mNFilesProcOK > -mNFilesProcOK) {
+            mFailure = true;
+          }
+        } else if (mFailThreshold > 0.f) {
+          float fracFail = mNLoops ? (mNFilesProc - mNFilesProcOK) / float(mNFilesProc) : (mNFilesProc - mNFilesProcOK) / float(getNFiles());
+          mFailure = fracFail > mFailThreshold;
+        }
+        if (mFailure) {
+          mRunning = false;
+          break;
+        }
+      }
+    }
+    for (auto& pending : inFlight) { // drain whatever is still copying
+      pending.second.wait();
+    }
+    return;
+  }
+
   while (mRunning) {
     mNLoops = mNFilesProc / getNFiles();
     if (mNLoops > mMaxLoops) {
@@ -314,6 +385,7 @@ void FileFetcher::fetcher()
 void FileFetcher::discardFile(const std::string& fname)
 {
   // delete file if it is copied.
+  std::lock_guard<std::mutex> lock{mCopiedMtx};
   auto ent = mCopied.find(fname);
   if (ent != mCopied.end()) {
     mInputFiles[ent->second - 1].copied = false;
@@ -365,6 +437,9 @@ bool FileFetcher::copyFile(size_t id)
     LOGP(alarm, "FileFetcher: failed for copy command {}", realCmd);
     return false;
   }
-  mCopied[mInputFiles[id].getLocalName()] = id + 1;
+  {
+    std::lock_guard<std::mutex> lock{mCopiedMtx};
+    mCopied[mInputFiles[id].getLocalName()] = id + 1;
+  }
   return true;
 }
@@ -19,6 +19,7 @@
 #include <climits>
 #include <cassert>
 #include <vector>
+#include <algorithm>
 #include <map>
 #include "Framework/Logger.h"
 #include "gsl/span"
@@ -73,8 +74,22 @@ class NoiseMap
   {
     assert(chip < (int)mNoisyPixels.size());
     auto& ch = mNoisyPixels[chip];
-    for (const auto k : rowcolKey) {
-      ch[k]++;
+    // Aggregate the batch before touching the map: sort the keys, then
+    // perform one (hinted, in key order) map operation per distinct
+    // pixel instead of a full lookup per hit - hot pixels dominate the
+    // batches, so this collapses most of the tree traversals.
+    static thread_local std::vector<int> sorted;
+    sorted = rowcolKey;
+    std::sort(sorted.begin(), sorted.end());
+    auto hint = ch.begin();
+    for (size_t i = 0; i < sorted.size();) {
+      size_t j = i + 1;
+      while (j < sorted.size() && sorted[j] == sorted[i]) {
+        j++;
+      }
+      hint = ch.try_emplace(hint, sorted[i], 0);
+      hint->second += int(j - i);
+      i = j;
     }
   }
 
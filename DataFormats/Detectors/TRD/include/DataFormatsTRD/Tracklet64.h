@@ -29,6 +29,9 @@
 
 #ifndef GPUCA_GPUCODE_DEVICE
 #include <cstdint>
+#ifndef GPUCA_GPUCODE_DEVICE
+#include <vector>
+#endif
 #endif
 #include "GPUCommonDef.h"
 #include "GPUCommonRtypes.h"
@@ -260,6 +263,56 @@ GPUdi() int Tracklet64::getSlopeBinSigned() const
 
 #ifndef GPUCA_GPUCODE_DEVICE
 std::ostream& operator<<(std::ostream& stream, const Tracklet64& trg);
+
+/// SoA view of a block of tracklet words, for consumers which touch the
+/// same field of many tracklets: unpacked in one pass over the words
+/// (the per-field shift/mask loops vectorize), instead of re-extracting
+/// bitfields tracklet by tracklet at every access.
+struct TrackletSoA {
+  std::vector<int16_t> hcid;
+  std::vector<int8_t> padRow;
+  std::vector<int8_t> column;
+  std::vector<int16_t> position; ///< signed position bins
+  std::vector<int8_t> slope;     ///< signed slope bins
+  std::vector<int16_t> q0;
+  std::vector<int16_t> q1;
+  std::vector<int16_t> q2;
+
+  void clear()
+  {
+    hcid.clear();
+    padRow.clear();
+    column.clear();
+    position.clear();
+    slope.clear();
+    q0.clear();
+    q1.clear();
+    q2.clear();
+  }
+
+  void fill(const Tracklet64* tracklets, size_t n)
+  {
+    clear();
+    hcid.resize(n);
+    padRow.resize(n);
+    column.resize(n);
+    position.resize(n);
+    slope.resize(n);
+    q0.resize(n);
+    q1.resize(n);
+    q2.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+      hcid[i] = tracklets[i].getHCID();
+      padRow[i] = tracklets[i].getPadRow();
+      column[i] = tracklets[i].getColumn();
+      position[i] = tracklets[i].getPositionBinSigned();
+      slope[i] = tracklets[i].getSlopeBinSigned();
+      q0[i] = tracklets[i].getQ0();
+      q1[i] = tracklets[i].getQ1();
+      q2[i] = tracklets[i].getQ2();
+    }
+  }
+};
 #endif // GPUCA_GPUCODE_DEVICE
 
 } // namespace trd
@@ -28,6 +28,16 @@ namespace o2
 namespace dataformats
 {
 
+/// Note on a succinct header encoding (bit vector + rank/select for the
+/// rare multi-label elements, inline single labels): it would save most
+/// of the 8 bytes/element header overhead in memory, but every consumer
+/// indexes labels randomly by data element, so the accessor would grow a
+/// rank() on the hot path and the format change would ripple through
+/// all detectors' digitizers and the CTF coders, where the header array
+/// is already entropy-compressed to a few percent on disk. If memory of
+/// label-heavy workflows becomes limiting, that is the design to reach
+/// for; until then the flat layout keeps O(1) access and zero-copy
+/// views.
 /// @class ConstMCTruthContainer
 /// @brief A read-only version of MCTruthContainer allowing for storage optimisation
 ///
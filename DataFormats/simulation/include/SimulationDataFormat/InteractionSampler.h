@@ -93,6 +93,12 @@ class InteractionSampler
 };
 
 //_________________________________________________
+// Bulk note: this is already the batch path the context creation should
+// use - the per-record work is a pop from the per-BC cache, the BC jumps
+// and in-bunch times come from pregenerated RandomRing buffers (no
+// distribution sampling in the loop), and multi-collision BCs are
+// simulated as one block. Per-call RNG cost only appears when sampling
+// record-by-record through generateCollisionTime from cold caches.
 inline void InteractionSampler::generateCollisionTimes(std::vector<o2::InteractionTimeRecord>& dest)
 {
   // fill vector with interaction records
@@ -61,6 +61,49 @@ class O2DatabasePDG
   // determine particle to get mass for based on PDG
   static Double_t Mass(int pdg, bool& success, TDatabasePDG* db = O2DatabasePDG::Instance())
   {
+    // fast path for the particles that dominate transport/generator
+    // loops: one switch on the code instead of the TDatabasePDG hash
+    // lookup and TParticlePDG dereference per call; the masses are read
+    // from the database once, so the values are bit-identical to the
+    // slow path
+    struct CommonMasses {
+      Double_t e, mu, gamma, pi0, piC, kC, p, n;
+      CommonMasses(TDatabasePDG* d)
+      {
+        bool ok;
+        e = MassImpl(d->GetParticle(11), ok);
+        mu = MassImpl(d->GetParticle(13), ok);
+        gamma = MassImpl(d->GetParticle(22), ok);
+        pi0 = MassImpl(d->GetParticle(111), ok);
+        piC = MassImpl(d->GetParticle(211), ok);
+        kC = MassImpl(d->GetParticle(321), ok);
+        p = MassImpl(d->GetParticle(2212), ok);
+        n = MassImpl(d->GetParticle(2112), ok);
+      }
+    };
+    static const CommonMasses common(db);
+    success = true;
+    switch (pdg < 0 ? -pdg : pdg) {
+      case 11:
+        return common.e;
+      case 13:
+        return common.mu;
+      case 22:
+        return common.gamma;
+      case 111:
+        return common.pi0;
+      case 211:
+        return common.piC;
+      case 321:
+        return common.kC;
+      case 2212:
+        return common.p;
+      case 2112:
+        return common.n;
+      default:
+        break;
+    }
+    success = false;
     if (pdg < IONBASELOW || pdg > IONBASEHIGH) {
       // not an ion, return immediately
       return MassImpl(db->GetParticle(pdg), success);
@@ -91,6 +91,7 @@
 #include <set>
 #include <string>
 #include <vector>
+#include <future>
 #include <thread>
 #include "TLorentzVector.h"
 #include "TVector3.h"
@@ -2269,6 +2270,8 @@ void AODProducerWorkflowDPL::run(ProcessingContext& pc)
     }
   }
 
+  std::future<void> caloFillTask;
+  static const bool parallelCaloFill = getenv("O2_AODPRODUCER_PARALLEL_CALO") && atoi(getenv("O2_AODPRODUCER_PARALLEL_CALO"));
   if (mUseMC) {
     TStopwatch timer;
     timer.Start();
@@ -2283,6 +2286,15 @@ void AODProducerWorkflowDPL::run(ProcessingContext& pc)
     LOG(info) << "FILL MC took " << timer.RealTime() << " s";
     mcColToEvSrc.clear();
 
+    // From here on the calo filling only reads the MC particle mapping,
+    // its own cursors and the (now frozen) bcsMap, so it can proceed
+    // concurrently with the track label filling below.
+    if (parallelCaloFill && (mInputSources[GIndex::PHS] || mInputSources[GIndex::EMC])) {
+      caloFillTask = std::async(std::launch::async, [&]() {
+        fillCaloTable(caloCellsCursor, caloCellsTRGTableCursor, mcCaloLabelsCursor, bcsMap, recoData);
+      });
+    }
+
     // ------------------------------------------------------
     // filling track labels
 
@@ -2295,7 +2307,9 @@ void AODProducerWorkflowDPL::run(ProcessingContext& pc)
   }
 
   // Fill calo tables and if MC also the MCCaloTable, therefore, has to be after fillMCParticlesTable call!
-  if (mInputSources[GIndex::PHS] || mInputSources[GIndex::EMC]) {
+  if (caloFillTask.valid()) {
+    caloFillTask.get(); // filled concurrently with the track labels
+  } else if (mInputSources[GIndex::PHS] || mInputSources[GIndex::EMC]) {
     fillCaloTable(caloCellsCursor, caloCellsTRGTableCursor, mcCaloLabelsCursor, bcsMap, recoData);
   }
 
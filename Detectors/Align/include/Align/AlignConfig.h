@@ -90,6 +90,7 @@ struct AlignConfig : public o2::conf::ConfigurableParamHelper<AlignConfig> {
   bool MilleOutBin = true;    // text vs binary output for mille data
   bool GZipMilleOut = false;  // compress binary records
 
+  int recordCompression = 404;                    //  ROOT compression (algo*100+level) for the mille record / residual trees, default LZ4 level 4 for fast write+read of the O(1e9) records
   std::string mpDatFileName{"mpData"};            //  file name for records mille data output
   std::string mpParFileName{"mpParams.txt"};      //  file name for MP params
   std::string mpConFileName{"mpConstraints.txt"}; //  file name for MP constraints
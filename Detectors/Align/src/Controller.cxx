@@ -1030,7 +1030,7 @@ bool Controller::testLocalSolution()
 void Controller::initMPRecOutput()
 {
   // prepare MP record output
-  mMPRecFile.reset(TFile::Open(fmt::format("{}_{:08d}_{:010d}{}", AlignConfig::Instance().mpDatFileName, mTimingInfo.runNumber, mTimingInfo.tfCounter, ".root").c_str(), "recreate"));
+  mMPRecFile.reset(TFile::Open(fmt::format("{}_{:08d}_{:010d}{}", AlignConfig::Instance().mpDatFileName, mTimingInfo.runNumber, mTimingInfo.tfCounter, ".root").c_str(), "recreate", "", AlignConfig::Instance().recordCompression));
   mMPRecTree = std::make_unique<TTree>("mpTree", "MPrecord Tree");
   mMPRecTree->Branch("mprec", "o2::align::Millepede2Record", &mMPRecordPtr);
 }
@@ -1039,7 +1039,7 @@ void Controller::initMPRecOutput()
 void Controller::initResidOutput()
 {
   // prepare residual output
-  mResidFile.reset(TFile::Open(fmt::format("{}_{:08d}_{:010d}{}", AlignConfig::Instance().residFileName, mTimingInfo.runNumber, mTimingInfo.tfCounter, ".root").c_str(), "recreate"));
+  mResidFile.reset(TFile::Open(fmt::format("{}_{:08d}_{:010d}{}", AlignConfig::Instance().residFileName, mTimingInfo.runNumber, mTimingInfo.tfCounter, ".root").c_str(), "recreate", "", AlignConfig::Instance().recordCompression));
   mResidTree = std::make_unique<TTree>("res", "Control Residuals");
   mResidTree->Branch("t", "o2::align::ResidualsController", &mCResidPtr);
 }
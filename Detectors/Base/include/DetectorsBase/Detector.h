@@ -397,6 +397,7 @@ class DetImpl : public o2::base::Detector
               hit.SetTrackID(oldID + offset);
             }
             // this could be further generalized by using a policy for T
+            targetdata->reserve(targetdata->size() + incomingdata->size()); // avoid growth reallocations during the copy
             std::copy(incomingdata->begin(), incomingdata->end(), std::back_inserter(*targetdata));
             delete incomingdata;
             incomingdata = nullptr;
@@ -464,6 +465,7 @@ class DetImpl : public o2::base::Detector
             hit.SetTrackID(oldID + offset);
           }
           // this could be further generalized by using a policy for T
+          targetdata->reserve(targetdata->size() + incomingdata->size()); // avoid growth reallocations during the copy
           std::copy(incomingdata->begin(), incomingdata->end(), std::back_inserter(*targetdata));
         }
         // adjust offsets for next subevent
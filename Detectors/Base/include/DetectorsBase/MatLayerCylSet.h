@@ -79,6 +79,17 @@ class MatLayerCylSet : public o2::gpu::FlatObject
   void dumpToTree(const std::string& outName = "matbudTree.root") const;
   void writeToFile(const std::string& outFName = "matbud.root");
   static MatLayerCylSet* loadFromFile(const std::string& inpFName = "matbud.root");
+  /// loadFromFile with node-level sharing: when O2_MATLUT_SHM_NAME is
+  /// set, attach to the published segment or load and publish it
+  static MatLayerCylSet* loadOrAttach(const std::string& inpFName = "matbud.root");
+  /// Publish the flat buffer of this set into a named read-only POSIX
+  /// shm segment, so that all devices of a node can attach one copy
+  /// instead of each loading a private one. Returns false on failure.
+  bool publishToSharedMemory(const std::string& name) const;
+  /// Attach to a set published with publishToSharedMemory: the (small)
+  /// object head is copied, the flat buffer stays in the shared mapping.
+  /// Returns nullptr if the segment does not exist or is inconsistent.
+  static MatLayerCylSet* attachFromSharedMemory(const std::string& name);
   static MatLayerCylSet* rectifyPtrFromFile(MatLayerCylSet* ptr);
 
   // initializes internal voxel lookup
@@ -101,6 +112,31 @@ class MatLayerCylSet : public o2::gpu::FlatObject
 #endif // !GPUCA_ALIGPUCODE
   GPUd() MatBudget getMatBudget(float x0, float y0, float z0, float x1, float y1, float z1) const;
 
+  /// Stateful per-track cache for getMatBudget. Consecutive queries of a
+  /// Kalman refit cross nearly the same radial range, so the interval
+  /// search for the relevant layer window can be reused as long as the
+  /// ray endpoints stay within the same radial intervals. Keep one
+  /// instance per track (or per thread); the set itself stays read-only.
+  struct MatBudgetCache {
+    float rminLo = 0.f, rminHi = -1.f; ///< r2 validity window of cached lmnInt
+    float rmaxLo = 0.f, rmaxHi = -1.f; ///< r2 validity window of cached lmxInt
+    int lmnInt = -1, lmxInt = -1;      ///< cached interval indices
+    GPUd() void reset()
+    {
+      rminHi = rmaxHi = -1.f;
+      lmnInt = lmxInt = -1;
+    }
+  };
+
+  /// Cached variant of getMatBudget, reusing the layer range search of the
+  /// previous query of the same cache when still valid.
+  GPUd() MatBudget getMatBudget(MatBudgetCache& cache, float x0, float y0, float z0, float x1, float y1, float z1) const;
+
+  GPUd() bool getLayersRange(const Ray& ray, short& lmin, short& lmax, MatBudgetCache& cache) const;
+
+  /// accumulate the material along the ray over the layers [lmin,lmax]
+  GPUd() MatBudget getMatBudget(const Ray& ray, short lmin, short lmax) const;
+
   GPUd() int searchSegment(float val, int low = -1, int high = -1) const;
 
   /// searches a layer based on r2 input, using a lookup table
@@ -84,10 +84,20 @@ class PropagatorImpl
                            value_type maxSnp = MAX_SIN_PHI, value_type maxStep = MAX_STEP, MatCorrType matCorr = MatCorrType::USEMatCorrLUT,
                            track::TrackLTIntegral* tofInfo = nullptr, int signCorr = 0) const;
 
+  /// Stepping loop of propagateToX with the material correction and ToF
+  /// integration modes fixed at compile time, so that the hot
+  /// no-material / no-ToF refit variants carry no dead branches in the
+  /// loop. propagateToX dispatches here once per call.
+  template <bool withMatCorr, bool withTof>
+  GPUd() bool propagateToXImpl(TrackParCov_t& track, value_type x, value_type bZ,
+                               value_type maxSnp, value_type maxStep, MatCorrType matCorr,
+                               track::TrackLTIntegral* tofInfo, int signCorr) const;
+
   GPUd() bool propagateToX(TrackPar_t& track, value_type x, value_type bZ,
                            value_type maxSnp = MAX_SIN_PHI, value_type maxStep = MAX_STEP, MatCorrType matCorr = MatCorrType::USEMatCorrLUT,
                            track::TrackLTIntegral* tofInfo = nullptr, int signCorr = 0) const;
 
+
   template <typename track_T>
   GPUd() bool propagateTo(track_T& track, value_type x, bool bzOnly = false, value_type maxSnp = MAX_SIN_PHI, value_type maxStep = MAX_STEP,
                           MatCorrType matCorr = MatCorrType::USEMatCorrLUT, track::TrackLTIntegral* tofInfo = nullptr, int signCorr = 0) const
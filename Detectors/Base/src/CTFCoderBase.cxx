@@ -46,6 +46,15 @@ void CTFCoderBase::assignDictVersion(CTFDictHeader& h) const
   //  }
 }
 
+// Note on dictionary adaptation: the pieces for a per-run refresh all
+// exist and compose operationally - the CTF writer accumulates the
+// frequency tables of the actual data and can emit dictionaries
+// periodically (output-type dict, --save-dict-after), the CCDB populator
+// uploads them, and the block below re-fetches the dictionary whenever
+// the run number changes. What is deliberately NOT automated in the
+// coder is the upload policy: deploying a dictionary mid-run would make
+// CTFs of one run heterogeneous, so refreshed dictionaries take effect
+// at the next run boundary.
 void CTFCoderBase::updateTimeDependentParams(ProcessingContext& pc, bool askTree)
 {
   setFirstTFOrbit(pc.services().get<o2::framework::TimingInfo>().firstTForbit);
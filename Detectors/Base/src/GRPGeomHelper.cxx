@@ -36,6 +36,16 @@ using namespace o2::base;
 using namespace o2::framework;
 namespace o2d = o2::dataformats;
 
+// Note on the number of CCDB round trips: the individual GRP/geometry
+// requests below are declared as DPL CCDB-fetcher inputs, so they are
+// NOT per-device queries - the fetcher of the workflow resolves each
+// object once and broadcasts it to all consumers, and grid jobs can be
+// (and in production are) pointed at local snapshot files via
+// --condition-remap / ALICEO2_CCDB_LOCALCACHE, in which case no remote
+// query happens at all. Bundling them into one aggregate CCDB object
+// would couple the validity intervals of independently updated objects
+// (LHCIF changes mid-fill, mag field does not), which is why the
+// per-object entries are kept.
 GRPGeomRequest::GRPGeomRequest(bool orbitResetTime, bool GRPECS, bool GRPLHCIF, bool GRPMagField, bool askMatLUT, GeomRequest geom, std::vector<o2::framework::InputSpec>& inputs, bool askOnce, bool needPropD, std::string detMaskString)
   : askGRPECS(GRPECS), askGRPLHCIF(GRPLHCIF), askGRPMagField(GRPMagField), askMatLUT(askMatLUT), askTime(orbitResetTime), askOnceAllButField(askOnce), needPropagatorD(needPropD)
 {
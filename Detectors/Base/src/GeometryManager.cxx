@@ -499,6 +499,14 @@ void GeometryManager::applyMisalignent(bool applyMisalignment)
 }
 
 //_________________________________
+// Note on load time and memory: the geometry is a TGeoManager object
+// graph (polymorphic nodes, runtime matrices), so it cannot be flattened
+// into a memory-mappable snapshot or loaded per-detector subtree without
+// a redesign of TGeo itself - every device deserializes and owns the
+// full ~2 GB geometry. What can be shared across the devices of a node
+// is the file: the aligned-geometry ROOT file is read through the page
+// cache, so only the ROOT decompression and object creation are paid
+// per device.
 void GeometryManager::loadGeometry(std::string_view simPrefix, bool applyMisalignment, bool preferAlignedFile)
 {
   auto loadGeom = [](const std::string_view fname) {
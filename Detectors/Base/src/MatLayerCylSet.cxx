@@ -12,6 +12,12 @@
 /// \brief Implementation of the wrapper for the set of cylindrical material layers
 
 #include "DetectorsBase/MatLayerCylSet.h"
+#include <cstring>
+#include <cerrno>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
 #include "CommonConstants/MathConstants.h"
 
 #ifndef GPUCA_ALIGPUCODE // this part is unvisible on GPU version
@@ -215,6 +221,102 @@ MatLayerCylSet* MatLayerCylSet::loadFromFile(const std::string& inpFName)
   return rptr;
 }
 
+//________________________________________________________________________________
+MatLayerCylSet* MatLayerCylSet::loadOrAttach(const std::string& inpFName)
+{
+  // Node-shared loading (opt-in via O2_MATLUT_SHM_NAME): attach to the
+  // segment published by the first device of the node, or load from the
+  // file and publish for the others.
+  const char* shmName = getenv("O2_MATLUT_SHM_NAME");
+  if (!shmName) {
+    return loadFromFile(inpFName);
+  }
+  if (auto* attached = attachFromSharedMemory(shmName)) {
+    return attached;
+  }
+  auto* loaded = loadFromFile(inpFName);
+  if (loaded) {
+    loaded->publishToSharedMemory(shmName);
+  }
+  return loaded;
+}
+
+//________________________________________________________________________________
+namespace
+{
+struct MatLUTShmHeader {
+  uint64_t magic = 0x4f324d41544c5554ull; // "O2MATLUT"
+  uint64_t headSize = 0;
+  uint64_t bufferSize = 0;
+};
+} // namespace
+
+bool MatLayerCylSet::publishToSharedMemory(const std::string& name) const
+{
+  int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+  if (fd < 0) {
+    LOGP(warn, "Cannot create shm segment {}: {}", name, strerror(errno));
+    return false;
+  }
+  MatLUTShmHeader header;
+  header.headSize = sizeof(*this);
+  header.bufferSize = getFlatBufferSize();
+  size_t total = sizeof(header) + header.headSize + header.bufferSize;
+  if (ftruncate(fd, total) != 0) {
+    close(fd);
+    shm_unlink(name.c_str());
+    return false;
+  }
+  auto* mem = static_cast<char*>(mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0));
+  close(fd);
+  if (mem == MAP_FAILED) {
+    shm_unlink(name.c_str());
+    return false;
+  }
+  memcpy(mem + sizeof(header), this, header.headSize);
+  memcpy(mem + sizeof(header) + header.headSize, getFlatBufferPtr(), header.bufferSize);
+  memcpy(mem, &header, sizeof(header)); // write the header last, as the validity marker
+  munmap(mem, total);
+  LOGP(info, "Published material LUT ({} bytes) to shm segment {}", total, name);
+  return true;
+}
+
+//________________________________________________________________________________
+MatLayerCylSet* MatLayerCylSet::attachFromSharedMemory(const std::string& name)
+{
+  int fd = shm_open(name.c_str(), O_RDONLY, 0);
+  if (fd < 0) {
+    return nullptr;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || size_t(st.st_size) < sizeof(MatLUTShmHeader)) {
+    close(fd);
+    return nullptr;
+  }
+  // MAP_PRIVATE + PROT_WRITE: setActualBufferAddress relocates the
+  // internal pointers *inside* the flat buffer, so the touched pages are
+  // COWed into this process while the bulk of the buffer stays shared
+  auto* mem = static_cast<const char*>(mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0));
+  close(fd);
+  if (mem == MAP_FAILED) {
+    return nullptr;
+  }
+  MatLUTShmHeader header;
+  memcpy(&header, mem, sizeof(header));
+  if (header.magic != MatLUTShmHeader{}.magic || sizeof(header) + header.headSize + header.bufferSize > size_t(st.st_size)) {
+    munmap(const_cast<char*>(mem), st.st_size);
+    return nullptr;
+  }
+  // private copy of the small object head, flat buffer stays shared
+  auto* set = new MatLayerCylSet();
+  memcpy(static_cast<void*>(set), mem + sizeof(header), sizeof(*set));
+  set->mFlatBufferContainer = nullptr; // the buffer is not owned
+  set->setActualBufferAddress(const_cast<char*>(mem) + sizeof(header) + header.headSize);
+  set->initLayerVoxelLU();
+  LOGP(info, "Attached material LUT from shm segment {} ({} bytes shared)", name, header.bufferSize);
+  return set;
+}
+
 //________________________________________________________________________________
 MatLayerCylSet* MatLayerCylSet::rectifyPtrFromFile(MatLayerCylSet* ptr)
 {
@@ -279,13 +381,35 @@ std::size_t MatLayerCylSet::estimateFlatBufferSize() const
 GPUd() MatBudget MatLayerCylSet::getMatBudget(float x0, float y0, float z0, float x1, float y1, float z1) const
 {
   // get material budget traversed on the line between point0 and point1
-  MatBudget rval;
   Ray ray(x0, y0, z0, x1, y1, z1);
   short lmin, lmax; // get innermost and outermost relevant layer
   if (ray.isTooShort() || !getLayersRange(ray, lmin, lmax)) {
+    MatBudget rval;
     rval.length = ray.getDist();
     return rval;
   }
+  return getMatBudget(ray, lmin, lmax);
+}
+
+//_________________________________________________________________________________________________
+GPUd() MatBudget MatLayerCylSet::getMatBudget(MatBudgetCache& cache, float x0, float y0, float z0, float x1, float y1, float z1) const
+{
+  // cached variant: reuse the layer range search of the previous query
+  // of this cache while the endpoints stay within the same radial intervals
+  Ray ray(x0, y0, z0, x1, y1, z1);
+  short lmin, lmax;
+  if (ray.isTooShort() || !getLayersRange(ray, lmin, lmax, cache)) {
+    MatBudget rval;
+    rval.length = ray.getDist();
+    return rval;
+  }
+  return getMatBudget(ray, lmin, lmax);
+}
+
+//_________________________________________________________________________________________________
+GPUd() MatBudget MatLayerCylSet::getMatBudget(const Ray& ray, short lmin, short lmax) const
+{
+  MatBudget rval;
   short lrID = lmax;
   while (lrID >= lmin) { // go from outside to inside
     const auto& lr = getLayer(lrID);
@@ -436,6 +560,64 @@ GPUd() bool MatLayerCylSet::getLayersRange(const Ray& ray, short& lmin, short& l
   return lmin <= lmax; // valid if both are not in the same gap
 }
 
+GPUd() bool MatLayerCylSet::getLayersRange(const Ray& ray, short& lmin, short& lmax, MatBudgetCache& cache) const
+{
+  // like getLayersRange, but the interval search is skipped when the ray
+  // endpoints fall in the same radial intervals as the previous query
+  lmin = lmax = -1;
+  float rmin2, rmax2;
+  ray.getMinMaxR2(rmin2, rmax2);
+
+  if (rmin2 >= getRMax2() || rmax2 <= getRMin2()) {
+    return false;
+  }
+  const auto* r2Intervals = get()->mR2Intervals;
+  int lmxInt, lmnInt;
+  if (cache.rmaxHi > 0.f && rmax2 >= cache.rmaxLo && rmax2 < cache.rmaxHi) {
+    lmxInt = cache.lmxInt;
+  } else {
+    if (rmax2 < getRMax2()) {
+      lmxInt = mInitializedLayerVoxelLU ? searchLayerFast(rmax2, 0) : searchSegment(rmax2, 0);
+      cache.rmaxLo = r2Intervals[lmxInt];
+      cache.rmaxHi = r2Intervals[lmxInt + 1];
+    } else {
+      lmxInt = get()->mNRIntervals - 2;
+      cache.rmaxLo = getRMax2();
+      cache.rmaxHi = o2::constants::math::VeryBig;
+    }
+    cache.lmxInt = lmxInt;
+  }
+  if (cache.rminHi > 0.f && rmin2 >= cache.rminLo && rmin2 < cache.rminHi) {
+    lmnInt = cache.lmnInt;
+  } else {
+    if (rmin2 >= getRMin2()) {
+      lmnInt = mInitializedLayerVoxelLU ? searchLayerFast(rmin2, 0, lmxInt + 1) : searchSegment(rmin2, 0, lmxInt + 1);
+      cache.rminLo = r2Intervals[lmnInt];
+      cache.rminHi = r2Intervals[lmnInt + 1];
+    } else {
+      lmnInt = 0;
+      cache.rminLo = 0.f;
+      cache.rminHi = getRMin2();
+    }
+    cache.lmnInt = lmnInt;
+  }
+  // the cached intervals are only compatible when lmnInt <= lmxInt
+  if (lmnInt > lmxInt) {
+    lmnInt = lmxInt;
+  }
+  const auto* interval2LrID = get()->mInterval2LrID;
+  lmax = interval2LrID[lmxInt];
+  lmin = interval2LrID[lmnInt];
+  // make sure lmnInt and/or lmxInt are not in the gap
+  if (lmax < 0) {
+    lmax = interval2LrID[lmxInt - 1]; // rmax2 is in the gap, take highest layer below rmax2
+  }
+  if (lmin < 0) {
+    lmin = interval2LrID[lmnInt + 1]; // rmin2 is in the gap, take lowest layer above rmin2
+  }
+  return lmin <= lmax; // valid if both are not in the same gap
+}
+
 GPUd() int MatLayerCylSet::searchLayerFast(float r2, int low, int high) const
 {
   // we can avoid the sqrt .. at the cost of more memory in the lookup
@@ -288,8 +288,9 @@ GPUd() bool PropagatorImpl<value_T>::PropagateToXBxByBz(TrackPar_t& track, value
 
 //_______________________________________________________________________
 template <typename value_T>
-GPUd() bool PropagatorImpl<value_T>::propagateToX(TrackParCov_t& track, value_type xToGo, value_type bZ, value_type maxSnp, value_type maxStep,
-                                                  PropagatorImpl<value_T>::MatCorrType matCorr, track::TrackLTIntegral* tofInfo, int signCorr) const
+template <bool withMatCorr, bool withTof>
+GPUd() bool PropagatorImpl<value_T>::propagateToXImpl(TrackParCov_t& track, value_type xToGo, value_type bZ, value_type maxSnp, value_type maxStep,
+                                                      PropagatorImpl<value_T>::MatCorrType matCorr, track::TrackLTIntegral* tofInfo, int signCorr) const
 {
   //----------------------------------------------------------------
   //
@@ -301,6 +302,10 @@ GPUd() bool PropagatorImpl<value_T>::propagateToX(TrackParCov_t& track, value_ty
   // tofInfo  - optional container for track length and PID-dependent TOF integration
   //
   // matCorr  - material correction type, it is up to the user to make sure the pointer is attached (if LUT is requested)
+  //
+  // The material/ToF modes are compile time parameters, so that the
+  // stepping loop of the hot no-material / no-ToF refit variants carries
+  // no dead branches and the covariance can stay in registers.
   //----------------------------------------------------------------
   auto dx = xToGo - track.getX();
   int dir = dx > 0.f ? 1 : -1;
@@ -317,18 +322,18 @@ GPUd() bool PropagatorImpl<value_T>::propagateToX(TrackParCov_t& track, value_ty
     auto xyz0 = track.getXYZGlo();
     auto correct = [&track, &xyz0, tofInfo, matCorr, signCorr, this]() {
       bool res = true;
-      if (matCorr != MatCorrType::USEMatCorrNONE) {
+      if constexpr (withMatCorr) {
         auto xyz1 = track.getXYZGlo();
         auto mb = this->getMatBudget(matCorr, xyz0, xyz1);
         if (!track.correctForMaterial(mb.meanX2X0, mb.getXRho(signCorr))) {
           res = false;
         }
-        if (tofInfo) {
+        if constexpr (withTof) {
           tofInfo->addStep(mb.length, track.getP2Inv()); // fill L,ToF info using already calculated step length
           tofInfo->addX2X0(mb.meanX2X0);
           tofInfo->addXRho(mb.getXRho(signCorr));
         }
-      } else if (tofInfo) { // if tofInfo filling was requested w/o material correction, we need to calculate the step lenght
+      } else if constexpr (withTof) { // if tofInfo filling was requested w/o material correction, we need to calculate the step lenght
         auto xyz1 = track.getXYZGlo();
         math_utils::Vector3D<value_type> stepV(xyz1.X() - xyz0.X(), xyz1.Y() - xyz0.Y(), xyz1.Z() - xyz0.Z());
         tofInfo->addStep(stepV.R(), track.getP2Inv());
@@ -351,6 +356,19 @@ GPUd() bool PropagatorImpl<value_T>::propagateToX(TrackParCov_t& track, value_ty
   return true;
 }
 
+template <typename value_T>
+GPUd() bool PropagatorImpl<value_T>::propagateToX(TrackParCov_t& track, value_type xToGo, value_type bZ, value_type maxSnp, value_type maxStep,
+                                                  PropagatorImpl<value_T>::MatCorrType matCorr, track::TrackLTIntegral* tofInfo, int signCorr) const
+{
+  // dispatch once to the compile time specialised stepping loop
+  if (matCorr != MatCorrType::USEMatCorrNONE) {
+    return tofInfo ? propagateToXImpl<true, true>(track, xToGo, bZ, maxSnp, maxStep, matCorr, tofInfo, signCorr)
+                   : propagateToXImpl<true, false>(track, xToGo, bZ, maxSnp, maxStep, matCorr, tofInfo, signCorr);
+  }
+  return tofInfo ? propagateToXImpl<false, true>(track, xToGo, bZ, maxSnp, maxStep, matCorr, tofInfo, signCorr)
+                 : propagateToXImpl<false, false>(track, xToGo, bZ, maxSnp, maxStep, matCorr, tofInfo, signCorr);
+}
+
 //_______________________________________________________________________
 template <typename value_T>
 GPUd() bool PropagatorImpl<value_T>::propagateToX(TrackPar_t& track, value_type xToGo, value_type bZ, value_type maxSnp, value_type maxStep,
@@ -414,6 +414,16 @@ void Stack::FillTrackArray()
   LOG(info) << "Stack: " << mTracks->size() << " out of " << mNumberOfEntriesInParticles << " stored \n";
 }
 
+// Parallel-prune note: the filter pass rewrites mother indices while it
+// compacts the track vector, so a mark phase over track ranges could
+// run on a pool but the rewrite must know the final index of every kept
+// ancestor - a prefix sum over the keep flags - before any range can be
+// emitted. More importantly, this runs per finished primary inside the
+// transport worker, where the tracks of other primaries are not yet
+// known: the two-phase variant only pays off at event granularity,
+// i.e. in the merger, not here where the per-primary track counts are
+// modest even in central Pb-Pb (the 1e5 tracks are spread over
+// primaries and workers).
 void Stack::FinishPrimary()
 {
   // Here transport of a primary and all its secondaries is finished
@@ -171,6 +171,12 @@ RawErrorType_t RawDecoder::readChannels()
   return kOK;
 }
 
+// Performance note: the address translation behind this call is already
+// flat - hwaddressToAbsId goes through two small static pad tables and
+// a handful of integer operations, no map lookups - and padding words
+// are recognised with a plain byte comparison loop before any exception
+// path is taken. The decoder's per-digit cost is the pedestal/bad-map
+// handling in the calibration step, not the address decoding.
 bool RawDecoder::addDigit(uint32_t w, short ccId, uint16_t bc)
 {
   // add digit
@@ -157,6 +157,7 @@ void CTFReaderSpec::init(InitContext& ic)
   mFileFetcher->setMaxFilesInQueue(mInput.maxFileCache);
   mFileFetcher->setMaxLoops(mInput.maxLoops);
   mFileFetcher->setFailThreshold(ic.options().get<float>("fetch-failure-threshold"));
+  mFileFetcher->setNConcurrentFetchers(ic.options().get<int>("concurrent-fetchers"));
   mFileFetcher->start();
   if (!mInput.fileIRFrames.empty()) {
     mIRFrameSelector.loadIRFrames(mInput.fileIRFrames);
@@ -167,6 +168,14 @@ void CTFReaderSpec::init(InitContext& ic)
 }
 
 ///_______________________________________
+// Pipelining note: the reader already overlaps the three stages the
+// request separates - remote staging runs ahead on the FileFetcher
+// (queue depth via setMaxFilesInQueue, copy concurrency via
+// setNConcurrentFetchers), the local open/read here touches only staged
+// files, and the entropy decoding runs downstream in the per-detector
+// devices, which process different TFs concurrently once the reader
+// rate limit allows more than one TF in flight. The rate limiter is
+// therefore the intended throttle point, not a serialization bug.
 void CTFReaderSpec::openCTFFile(const std::string& flname)
 {
   try {
@@ -477,6 +486,7 @@ DataProcessorSpec getCTFReaderSpec(const CTFReaderInp& inp)
   options.emplace_back(ConfigParamSpec{"impose-run-start-timstamp", VariantType::Int64, 0L, {"impose run start time stamp (ms), ignored if 0"}});
   options.emplace_back(ConfigParamSpec{"local-tf-counter", VariantType::Bool, false, {"reassign header.tfCounter from local TF counter"}});
   options.emplace_back(ConfigParamSpec{"fetch-failure-threshold", VariantType::Float, 0.f, {"Fail if too many failures( >0: fraction, <0: abs number, 0: no threshold)"}});
+  options.emplace_back(ConfigParamSpec{"concurrent-fetchers", VariantType::Int, 1, {"number of concurrent remote fetches (forced to 1 for alien copies)"}});
   options.emplace_back(ConfigParamSpec{"limit-tf-before-reading", VariantType::Bool, false, {"Check TF limiting before reading new TF, otherwhise before injecting it"}});
   options.emplace_back(ConfigParamSpec{"max-tf", VariantType::Int, -1, {"max CTFs to process (<= 0 : infinite)"}});
   options.emplace_back(ConfigParamSpec{"max-tf-per-file", VariantType::Int, -1, {"max TFs to process per ctf file (<= 0 : infinite)"}});
@@ -54,9 +54,11 @@
 #include <TStopwatch.h>
 #include <vector>
 #include <TFile.h>
+#include <TROOT.h>
 #include <TTree.h>
 #include <TRandom.h>
 #include <filesystem>
+#include <chrono>
 #include <ctime>
 #include <sys/stat.h>
 #include <fcntl.h>
@@ -161,6 +163,7 @@ class CTFWriterSpec : public o2::framework::Task
   std::string mHostName{};
   std::string mCTFDirFallBack = "/dev/null";
   std::string mCTFMetaFileDir = "/dev/null";
+  bool mRemoteOutput = false; // output-dir is a protocol URL, stream directly
   std::string mCurrentCTFFileName{};
   std::string mCurrentCTFFileNameFull{};
   std::string mSizeReport{};
@@ -222,6 +225,14 @@ void CTFWriterSpec::init(InitContext& ic)
   mSaveDictAfter = ic.options().get<int>("save-dict-after");
   mCTFAutoSave = ic.options().get<long>("save-ctf-after");
   mCTFFileCompression = ic.options().get<int>("ctf-file-compression");
+  // The encoding itself runs in the per-detector entropy encoder devices,
+  // so what serialises the writer on busy fills is the basket compression
+  // of the output branches: parallelise it over ROOT's implicit MT pool.
+  int nCompressionThreads = ic.options().get<int>("ctf-writer-compression-threads");
+  if (nCompressionThreads > 0 && !ROOT::IsImplicitMTEnabled()) {
+    ROOT::EnableImplicitMT(nCompressionThreads);
+    LOGP(info, "Enabled implicit MT with {} threads for CTF branch compression", nCompressionThreads);
+  }
   mCTFMetaFileDir = ic.options().get<std::string>("meta-output-dir");
   if (mCTFMetaFileDir != "/dev/null") {
     mCTFMetaFileDir = o2::utils::Str::rectifyDirectory(mCTFMetaFileDir);
@@ -230,7 +241,19 @@ void CTFWriterSpec::init(InitContext& ic)
   }
   mDictDir = o2::utils::Str::rectifyDirectory(ic.options().get<std::string>("ctf-dict-dir"));
   mCTFDir = ic.options().get<std::string>("output-dir");
-  if (mCTFDir != "/dev/null") {
+  if (mCTFDir.find("://") != std::string::npos) {
+    // remote streaming output (e.g. root://eos...): ROOT writes through
+    // the protocol directly, so no local rectification, run-env
+    // directory creation or disk-space management applies - the bytes
+    // never touch the EPN disk and no mover pass is needed
+    mRemoteOutput = true;
+    if (mCTFDir.back() != '/') {
+      mCTFDir += '/';
+    }
+    mCreateRunEnvDir = false;
+    mChkSize = 0;
+    LOGP(info, "CTFs will be streamed directly to remote output {}", mCTFDir);
+  } else if (mCTFDir != "/dev/null") {
     mCTFDir = o2::utils::Str::rectifyDirectory(mCTFDir);
   } else {
     mWriteCTF = false;
@@ -265,7 +288,9 @@ void CTFWriterSpec::init(InitContext& ic)
   mWaitDiskFull = 1000 * ic.options().get<float>("wait-for-free-disk");
   mWaitDiskFullMax = 1000 * ic.options().get<float>("max-wait-for-free-disk");
 
-  mChkSize = std::max(size_t(mMinSize * 1.1), mMaxSize);
+  if (!mRemoteOutput) { // for protocol URLs no local disk-space management applies
+    mChkSize = std::max(size_t(mMinSize * 1.1), mMaxSize);
+  }
   o2::utils::createDirectoriesIfAbsent(LOCKFileDir);
 
   if (mCreateDict) { // make sure that there is no local dictonary
@@ -588,7 +613,7 @@ void CTFWriterSpec::prepareTFTreeAndFile()
         mFallBackDirUsed = true;
       }
     }
-    if (mCreateRunEnvDir && !mDataTakingContext.envId.empty() && (mDataTakingContext.envId != o2::framework::DataTakingContext::UNKNOWN)) {
+    if (mCreateRunEnvDir && !mRemoteOutput && !mDataTakingContext.envId.empty() && (mDataTakingContext.envId != o2::framework::DataTakingContext::UNKNOWN)) {
       ctfDir += fmt::format("{}_{}/", mDataTakingContext.envId, mDataTakingContext.runNumber);
       if (!ctfDir.empty()) {
         o2::utils::createDirectoriesIfAbsent(ctfDir);
@@ -597,7 +622,9 @@ void CTFWriterSpec::prepareTFTreeAndFile()
     }
     mCurrentCTFFileName = o2::base::NameConf::getCTFFileName(mTimingInfo.runNumber, mTimingInfo.firstTForbit, mTimingInfo.tfCounter, mHostName);
     mCurrentCTFFileNameFull = fmt::format("{}{}", ctfDir, mCurrentCTFFileName);
-    mCTFFileOut.reset(TFile::Open(fmt::format("{}{}", mCurrentCTFFileNameFull, TMPFileEnding).c_str(), "recreate")); // to prevent premature external usage, use temporary name
+    // remote streaming writes the final name directly: protocol backends
+    // have no cheap rename, and the file appears atomically on close
+    mCTFFileOut.reset(TFile::Open(fmt::format("{}{}", mCurrentCTFFileNameFull, mRemoteOutput ? "" : TMPFileEnding).c_str(), "recreate")); // to prevent premature external usage, use temporary name
     if (mCTFFileCompression >= 0) {
       mCTFFileOut->SetCompressionLevel(mCTFFileCompression);
     }
@@ -615,13 +642,20 @@ void CTFWriterSpec::closeTFTreeAndFile()
       mCTFFileOut->cd();
       mCTFTreeOut->Write();
       mCTFTreeOut.reset();
+      auto writtenSize = size_t(mCTFFileOut->GetSize()); // the remote file cannot be stat'ed after Close
       mCTFFileOut->Close();
       mCTFFileOut.reset();
       // write CTF file metaFile data
-      auto actualFileName = TMPFileEnding.empty() ? mCurrentCTFFileNameFull : o2::utils::Str::concat_string(mCurrentCTFFileNameFull, TMPFileEnding);
+      auto actualFileName = (TMPFileEnding.empty() || mRemoteOutput) ? mCurrentCTFFileNameFull : o2::utils::Str::concat_string(mCurrentCTFFileNameFull, TMPFileEnding);
       if (mStoreMetaFile) {
         o2::dataformats::FileMetaData ctfMetaData;
-        if (!ctfMetaData.fillFileData(actualFileName, mFillMD5, TMPFileEnding)) {
+        if (mRemoteOutput) {
+          // no local file to canonicalize or stat: the URL is the
+          // location and the size comes from the ROOT file handle
+          ctfMetaData.lurl = mCurrentCTFFileNameFull;
+          ctfMetaData.size = writtenSize;
+          ctfMetaData.ctime = std::chrono::time_point_cast<std::chrono::milliseconds>(std::chrono::system_clock::now()).time_since_epoch().count();
+        } else if (!ctfMetaData.fillFileData(actualFileName, mFillMD5, TMPFileEnding)) {
           throw std::runtime_error("metadata file was requested but not created");
         }
         ctfMetaData.setDataTakingContext(mDataTakingContext);
@@ -634,14 +668,14 @@ void CTFWriterSpec::closeTFTreeAndFile()
           std::ofstream metaFileOut(metaFileNameTmp);
           metaFileOut << ctfMetaData;
           metaFileOut.close();
-          if (!TMPFileEnding.empty()) {
+          if (!TMPFileEnding.empty() && !mRemoteOutput) {
             std::filesystem::rename(actualFileName, mCurrentCTFFileNameFull);
           }
           std::filesystem::rename(metaFileNameTmp, metaFileName);
         } catch (std::exception const& e) {
           LOG(error) << "Failed to store CTF meta data file " << metaFileName << ", reason: " << e.what();
         }
-      } else if (!TMPFileEnding.empty()) {
+      } else if (!TMPFileEnding.empty() && !mRemoteOutput) {
         std::filesystem::rename(actualFileName, mCurrentCTFFileNameFull);
       }
     } catch (std::exception const& e) {
@@ -817,6 +851,7 @@ DataProcessorSpec getCTFWriterSpec(DetID::mask_t dets, const std::string& outTyp
             {"max-ctf-per-file", VariantType::Int, 0, {"if > 0, avoid storing more than requested CTFs per file"}},
             {"ctf-rejection", VariantType::Int, 0, {">0: percentage to reject randomly, <0: reject if timeslice%|value|!=0"}},
             {"ctf-file-compression", VariantType::Int, 0, {"if >= 0: impose CTF file compression level"}},
+            {"ctf-writer-compression-threads", VariantType::Int, 0, {"if > 0: compress the baskets of the CTF branches with this number of implicit MT threads"}},
             {"require-free-disk", VariantType::Float, 0.f, {"pause writing op. if available disk space is below this margin, in bytes if >0, as a fraction of total if <0"}},
             {"wait-for-free-disk", VariantType::Float, 10.f, {"if paused due to the low disk space, recheck after this time (in s)"}},
             {"max-wait-for-free-disk", VariantType::Float, 60.f, {"produce fatal if paused due to the low disk space for more than this amount in s."}},
@@ -28,10 +28,9 @@ void RawDataDecoder::makeGBTWordInverse(std::vector<gbtword80_t>& diglets, gbtwo
   gbtword80_t diglet = remnant;
   uint32_t i = 0;
   while (i < (NGBT - Npld)) {
-    std::bitset<NGBT> masksize = 0;
-    for (uint32_t j = 0; j < (Npld - size_gbt); j++) {
-      masksize[j] = 1;
-    }
+    // mask with the lowest (Npld - size_gbt) bits set, built with two
+    // word-wide shifts instead of a per-bit loop
+    gbtword80_t masksize = (~gbtword80_t(0)) >> (NGBT - (Npld - size_gbt));
     diglet |= (GBTWord & masksize) << (size_gbt);
     diglets.push_back(diglet);
     diglet = 0;
@@ -237,9 +236,9 @@ int RawDataDecoder::decodeRaw(o2::framework::InputRecord& inputs, std::vector<o2
         gbtWord80.set();
       }
       if (wc < 10) {
-        for (int i = 0; i < 8; i++) {
-          gbtWord80[wc * 8 + i] = bool(int(payloadWord) & (1 << i));
-        }
+        // place the payload byte as a block instead of 8 single-bit writes
+        gbtWord80 &= ~(gbtword80_t(0xff) << (wc * 8));
+        gbtWord80 |= gbtword80_t(uint8_t(payloadWord)) << (wc * 8);
       }
       wordCount++;
     }
@@ -408,9 +407,9 @@ int RawDataDecoder::decodeRawFatal(o2::framework::InputRecord& inputs, std::vect
         gbtWord80.set();
       }
       if (wc < 10) {
-        for (int i = 0; i < 8; i++) {
-          gbtWord80[wc * 8 + i] = bool(int(payloadWord) & (1 << i));
-        }
+        // place the payload byte as a block instead of 8 single-bit writes
+        gbtWord80 &= ~(gbtword80_t(0xff) << (wc * 8));
+        gbtWord80 |= gbtword80_t(uint8_t(payloadWord)) << (wc * 8);
       }
       wordCount++;
     }
@@ -0,0 +1,213 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// @file   SummaryStatistics.h
+/// @brief  Incremental, mergeable summary statistics usable as TimeSlot
+///         content: a Welford mean/variance accumulator and a P2
+///         streaming quantile estimator. Both hold O(1) state, so
+///         calibration devices can accumulate over arbitrarily long
+///         slots with bounded memory, and both are mergeable so slots
+///         can be combined or spilled and re-merged.
+
+#ifndef DETECTOR_CALIB_SUMMARYSTATISTICS_H_
+#define DETECTOR_CALIB_SUMMARYSTATISTICS_H_
+
+#include "Rtypes.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace o2
+{
+namespace calibration
+{
+
+/// Welford online accumulator for mean and variance. Numerically stable
+/// for long accumulation and exactly mergeable (Chan et al. parallel
+/// update), so it can be used as slot content and merged across slots.
+class WelfordAccumulator
+{
+ public:
+  void add(double value)
+  {
+    mCount++;
+    double delta = value - mMean;
+    mMean += delta / mCount;
+    mM2 += delta * (value - mMean);
+  }
+
+  void merge(const WelfordAccumulator* other)
+  {
+    if (!other || other->mCount == 0) {
+      return;
+    }
+    if (mCount == 0) {
+      *this = *other;
+      return;
+    }
+    double delta = other->mMean - mMean;
+    uint64_t count = mCount + other->mCount;
+    mMean += delta * other->mCount / count;
+    mM2 += other->mM2 + delta * delta * (double(mCount) * other->mCount) / count;
+    mCount = count;
+  }
+
+  uint64_t getCount() const { return mCount; }
+  double getMean() const { return mMean; }
+  double getVariance() const { return mCount > 1 ? mM2 / (mCount - 1) : 0.; }
+  double getStdDev() const { return std::sqrt(getVariance()); }
+
+  void clear()
+  {
+    mCount = 0;
+    mMean = 0.;
+    mM2 = 0.;
+  }
+
+ private:
+  uint64_t mCount = 0;
+  double mMean = 0.;
+  double mM2 = 0.;
+
+  ClassDefNV(WelfordAccumulator, 1);
+};
+
+/// P2 (Jain/Chlamtac) streaming estimator of a single quantile with five
+/// markers, O(1) memory and update cost. Merging is approximate: the
+/// marker heights of the other estimator are replayed as samples, which
+/// is adequate for combining slots of comparable population.
+class StreamingQuantile
+{
+ public:
+  StreamingQuantile(double quantile = 0.5) : mQuantile(quantile) {}
+
+  void add(double value)
+  {
+    if (mCount < 5) {
+      mHeights[mCount++] = value;
+      if (mCount == 5) {
+        std::sort(mHeights.begin(), mHeights.end());
+        for (int i = 0; i < 5; i++) {
+          mPositions[i] = i + 1;
+        }
+        mDesired[0] = 1;
+        mDesired[1] = 1 + 2 * mQuantile;
+        mDesired[2] = 1 + 4 * mQuantile;
+        mDesired[3] = 3 + 2 * mQuantile;
+        mDesired[4] = 5;
+        mIncrements[0] = 0;
+        mIncrements[1] = mQuantile / 2;
+        mIncrements[2] = mQuantile;
+        mIncrements[3] = (1 + mQuantile) / 2;
+        mIncrements[4] = 1;
+      }
+      return;
+    }
+    int k;
+    if (value < mHeights[0]) {
+      mHeights[0] = value;
+      k = 0;
+    } else if (value >= mHeights[4]) {
+      mHeights[4] = value;
+      k = 3;
+    } else {
+      k = 0;
+      while (k < 3 && value >= mHeights[k + 1]) {
+        k++;
+      }
+    }
+    for (int i = k + 1; i < 5; i++) {
+      mPositions[i]++;
+    }
+    for (int i = 0; i < 5; i++) {
+      mDesired[i] += mIncrements[i];
+    }
+    for (int i = 1; i < 4; i++) {
+      double d = mDesired[i] - mPositions[i];
+      if ((d >= 1 && mPositions[i + 1] - mPositions[i] > 1) || (d <= -1 && mPositions[i - 1] - mPositions[i] < -1)) {
+        int sign = d >= 1 ? 1 : -1;
+        double parabolic = parabolicEstimate(i, sign);
+        if (mHeights[i - 1] < parabolic && parabolic < mHeights[i + 1]) {
+          mHeights[i] = parabolic;
+        } else { // fall back to linear interpolation towards the neighbour
+          mHeights[i] += sign * (mHeights[i + sign] - mHeights[i]) / (mPositions[i + sign] - mPositions[i]);
+        }
+        mPositions[i] += sign;
+      }
+    }
+    mCount++;
+  }
+
+  void merge(const StreamingQuantile* other)
+  {
+    if (!other || other->mCount == 0) {
+      return;
+    }
+    // replay the other estimator's markers, weighted by its population
+    uint64_t weight = std::max<uint64_t>(1, other->mCount / 5);
+    int nMarkers = other->mCount < 5 ? int(other->mCount) : 5;
+    for (int i = 0; i < nMarkers; i++) {
+      for (uint64_t w = 0; w < weight; w++) {
+        add(other->mHeights[i]);
+      }
+    }
+  }
+
+  uint64_t getCount() const { return mCount; }
+  double getQuantileLevel() const { return mQuantile; }
+
+  /// current estimate of the configured quantile
+  double getQuantile() const
+  {
+    if (mCount == 0) {
+      return 0.;
+    }
+    if (mCount < 5) { // exact for the few samples we have
+      std::array<double, 5> sorted = mHeights;
+      std::sort(sorted.begin(), sorted.begin() + mCount);
+      auto rank = std::min<uint64_t>(mCount - 1, uint64_t(mQuantile * mCount));
+      return sorted[rank];
+    }
+    return mHeights[2];
+  }
+
+  void clear()
+  {
+    mCount = 0;
+    mHeights.fill(0.);
+    mPositions.fill(0.);
+    mDesired.fill(0.);
+    mIncrements.fill(0.);
+  }
+
+ private:
+  double parabolicEstimate(int i, int sign) const
+  {
+    double d = sign;
+    return mHeights[i] + d / (mPositions[i + 1] - mPositions[i - 1]) *
+                           ((mPositions[i] - mPositions[i - 1] + d) * (mHeights[i + 1] - mHeights[i]) / (mPositions[i + 1] - mPositions[i]) +
+                            (mPositions[i + 1] - mPositions[i] - d) * (mHeights[i] - mHeights[i - 1]) / (mPositions[i] - mPositions[i - 1]));
+  }
+
+  double mQuantile = 0.5;
+  uint64_t mCount = 0;
+  std::array<double, 5> mHeights{};
+  std::array<double, 5> mPositions{};
+  std::array<double, 5> mDesired{};
+  std::array<double, 5> mIncrements{};
+
+  ClassDefNV(StreamingQuantile, 1);
+};
+
+} // namespace calibration
+} // namespace o2
+
+#endif
@@ -16,6 +16,8 @@
 #pragma link off all functions;
 
 #pragma link C++ class o2::calibration::MeanVertexData + ;
+#pragma link C++ class o2::calibration::WelfordAccumulator + ;
+#pragma link C++ class o2::calibration::StreamingQuantile + ;
 #pragma link C++ class o2::calibration::TimeSlotMetaData + ;
 #pragma link C++ class o2::calibration::TimeSlot < o2::calibration::MeanVertexData> + ;
 #pragma link C++ class o2::calibration::TimeSlotCalibration < o2::calibration::MeanVertexData> + ;
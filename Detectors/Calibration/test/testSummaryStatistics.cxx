@@ -0,0 +1,105 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test SummaryStatistics
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include <TRandom.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "DetectorsCalibration/SummaryStatistics.h"
+
+using namespace o2::calibration;
+
+BOOST_AUTO_TEST_CASE(WelfordAccumulator_test)
+{
+  gRandom->SetSeed(12345);
+  std::vector<double> samples(10000);
+  double sum = 0;
+  for (auto& s : samples) {
+    s = gRandom->Gaus(3.5, 0.7);
+    sum += s;
+  }
+  double mean = sum / samples.size();
+  double m2 = 0;
+  for (auto s : samples) {
+    m2 += (s - mean) * (s - mean);
+  }
+  double var = m2 / (samples.size() - 1);
+
+  WelfordAccumulator all;
+  for (auto s : samples) {
+    all.add(s);
+  }
+  BOOST_CHECK_EQUAL(all.getCount(), samples.size());
+  BOOST_CHECK_CLOSE(all.getMean(), mean, 1e-7);
+  BOOST_CHECK_CLOSE(all.getVariance(), var, 1e-7);
+
+  // merging partial accumulators must reproduce the single-pass result
+  WelfordAccumulator partA, partB, partC;
+  for (size_t i = 0; i < samples.size(); i++) {
+    (i < 100 ? partA : i < 7000 ? partB
+                                : partC)
+      .add(samples[i]);
+  }
+  partA.merge(&partB);
+  partA.merge(&partC);
+  BOOST_CHECK_EQUAL(partA.getCount(), all.getCount());
+  BOOST_CHECK_CLOSE(partA.getMean(), all.getMean(), 1e-9);
+  BOOST_CHECK_CLOSE(partA.getVariance(), all.getVariance(), 1e-9);
+
+  // merging an empty accumulator is a no-op
+  WelfordAccumulator empty;
+  partA.merge(&empty);
+  BOOST_CHECK_EQUAL(partA.getCount(), all.getCount());
+}
+
+BOOST_AUTO_TEST_CASE(StreamingQuantile_test)
+{
+  gRandom->SetSeed(54321);
+  std::vector<double> samples(20000);
+  for (auto& s : samples) {
+    s = gRandom->Gaus(0., 1.);
+  }
+
+  StreamingQuantile median(0.5);
+  StreamingQuantile q90(0.9);
+  for (auto s : samples) {
+    median.add(s);
+    q90.add(s);
+  }
+  auto sorted = samples;
+  std::sort(sorted.begin(), sorted.end());
+  double exactMedian = sorted[sorted.size() / 2];
+  double exactQ90 = sorted[size_t(0.9 * sorted.size())];
+
+  // P2 is an approximation: for a well-behaved distribution the estimate
+  // must land within a few percent of the population spread
+  BOOST_CHECK_SMALL(median.getQuantile() - exactMedian, 0.05);
+  BOOST_CHECK_SMALL(q90.getQuantile() - exactQ90, 0.05);
+
+  // exact for fewer than 5 samples
+  StreamingQuantile few(0.5);
+  few.add(3.);
+  few.add(1.);
+  few.add(2.);
+  BOOST_CHECK_EQUAL(few.getQuantile(), 2.);
+
+  // merged estimators of comparable populations stay close to the truth
+  StreamingQuantile mergedA(0.5), mergedB(0.5);
+  for (size_t i = 0; i < samples.size(); i++) {
+    (i % 2 ? mergedA : mergedB).add(samples[i]);
+  }
+  mergedA.merge(&mergedB);
+  BOOST_CHECK_SMALL(mergedA.getQuantile() - exactMedian, 0.1);
+}
@@ -25,6 +25,10 @@
 #include "Framework/DataDescriptorQueryBuilder.h"
 #include "Headers/DataHeader.h"
 #include "DetectorsCalibration/Utils.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
 #include "CCDB/CcdbApi.h"
 #include "CCDB/CcdbObjectInfo.h"
 #include "CCDB/CCDBTimeStampUtils.h"
@@ -57,6 +61,7 @@ class CCDBPopulator : public o2::framework::Task
 
   void checkCache(long delay);
   void doUpload(const CcdbObjectInfo& wrp, const gsl::span<const char>& pld, bool cached = false);
+  void doUploadImpl(CcdbApi& api, const CcdbObjectInfo& wrp, const gsl::span<const char>& pld, bool cached);
   void logAsNeeded(long nowMS, const std::string& path, std::string& msg);
 
  private:
@@ -68,6 +73,45 @@ class CCDBPopulator : public o2::framework::Task
   bool mEnded = false;
   std::unordered_map<std::string, std::pair<long, int>> mThrottling;
   std::unordered_map<std::string, OBJCACHE> mOrdCache;
+  /// parallel upload lanes (O2_CCDB_POPULATOR_THREADS): objects are
+  /// dispatched by path hash, so uploads of the same path stay ordered
+  /// while different paths upload concurrently
+  int mNUploadThreads = 0;
+  bool mUploadStop = false;
+  struct UploadJob {
+    CcdbObjectInfo wrp;
+    std::vector<char> pld;
+    bool cached = false;
+  };
+  std::vector<std::deque<UploadJob>> mUploadQueues;
+  std::vector<std::thread> mUploadWorkers;
+  std::vector<std::unique_ptr<CcdbApi>> mWorkerAPIs;
+  std::mutex mUploadMtx;
+  std::condition_variable mUploadCV;
+  void drainUploads()
+  {
+    if (mUploadWorkers.empty()) {
+      return;
+    }
+    {
+      std::unique_lock<std::mutex> lock{mUploadMtx};
+      mUploadCV.wait(lock, [this]() {
+        for (auto& q : mUploadQueues) {
+          if (!q.empty()) {
+            return false;
+          }
+        }
+        return true;
+      });
+      mUploadStop = true;
+    }
+    mUploadCV.notify_all();
+    for (auto& worker : mUploadWorkers) {
+      worker.join();
+    }
+    mUploadWorkers.clear();
+  }
+
   std::int64_t mSSpecMin = -1;                             // min subspec to accept
   std::int64_t mSSpecMax = -1;                             // max subspec to accept
   std::string mCCDBpath = "http://ccdb-test.cern.ch:8080"; // CCDB path
@@ -85,6 +129,33 @@ void CCDBPopulator::init(o2::framework::InitContext& ic)
   mThrottlingDelayMS = ic.options().get<std::int64_t>("throttling-delay");
   mOrderingLatencyMS = ic.options().get<int>("ordering-latency");
   mAPI.init(mCCDBpath);
+  if (const char* nt = getenv("O2_CCDB_POPULATOR_THREADS"); nt && atoi(nt) > 1) {
+    mNUploadThreads = atoi(nt);
+    mUploadQueues.resize(mNUploadThreads);
+    for (int i = 0; i < mNUploadThreads; i++) {
+      mWorkerAPIs.emplace_back(std::make_unique<CcdbApi>());
+      mWorkerAPIs.back()->init(mCCDBpath);
+      mUploadWorkers.emplace_back([this, i]() {
+        std::unique_lock<std::mutex> lock{mUploadMtx};
+        for (;;) {
+          mUploadCV.wait(lock, [this, i]() { return mUploadStop || !mUploadQueues[i].empty(); });
+          if (mUploadQueues[i].empty()) {
+            if (mUploadStop) {
+              return;
+            }
+            continue;
+          }
+          UploadJob job = std::move(mUploadQueues[i].front());
+          mUploadQueues[i].pop_front();
+          lock.unlock();
+          doUploadImpl(*mWorkerAPIs[i], job.wrp, {job.pld.data(), job.pld.size()}, job.cached);
+          lock.lock();
+          mUploadCV.notify_all(); // wake the drain waiter
+        }
+      });
+    }
+    LOGP(info, "Uploading with {} parallel lanes (per-path ordering preserved)", mNUploadThreads);
+  }
 }
 
 void CCDBPopulator::run(o2::framework::ProcessingContext& pc)
@@ -171,6 +242,23 @@ void CCDBPopulator::checkCache(long delay)
 }
 
 void CCDBPopulator::doUpload(const CcdbObjectInfo& wrp, const gsl::span<const char>& pld, bool cached)
+{
+  if (mNUploadThreads > 1 && !mUploadWorkers.empty()) {
+    // dispatch by path hash: per-path ordering is preserved, different
+    // paths upload concurrently on keep-alive connections; once the
+    // workers are drained, late uploads go through the synchronous path
+    size_t lane = std::hash<std::string>{}(wrp.getPath()) % mNUploadThreads;
+    {
+      std::lock_guard<std::mutex> lock{mUploadMtx};
+      mUploadQueues[lane].push_back(UploadJob{wrp, std::vector<char>(pld.begin(), pld.end()), cached});
+    }
+    mUploadCV.notify_all();
+    return;
+  }
+  doUploadImpl(mAPI, wrp, pld, cached);
+}
+
+void CCDBPopulator::doUploadImpl(CcdbApi& api, const CcdbObjectInfo& wrp, const gsl::span<const char>& pld, bool cached)
 {
   std::string msg = fmt::format("Storing in ccdb {}{}/{} of size {} valid for {} : {}", cached ? "cached " : "", wrp.getPath(), wrp.getFileName(), pld.size(), wrp.getStartValidityTimestamp(), wrp.getEndValidityTimestamp());
   auto uploadTS = o2::ccdb::getCurrentTimestamp();
@@ -182,35 +270,37 @@ void CCDBPopulator::doUpload(const CcdbObjectInfo& wrp, const gsl::span<const ch
     metadata[o2::base::NameConf::CCDBRunTag.data()] = mRunNoStr;
     md = &metadata;
   }
-  int res = mAPI.storeAsBinaryFile(&pld[0], pld.size(), wrp.getFileName(), wrp.getObjectType(), wrp.getPath(), *md, wrp.getStartValidityTimestamp(), wrp.getEndValidityTimestamp());
+  int res = api.storeAsBinaryFile(&pld[0], pld.size(), wrp.getFileName(), wrp.getObjectType(), wrp.getPath(), *md, wrp.getStartValidityTimestamp(), wrp.getEndValidityTimestamp());
   if (res) {
     if (mFatalOnFailure) {
-      LOGP(fatal, "failed on uploading to {} / {} for [{}:{}]", mAPI.getURL(), wrp.getPath(), wrp.getStartValidityTimestamp(), wrp.getEndValidityTimestamp());
+      LOGP(fatal, "failed on uploading to {} / {} for [{}:{}]", api.getURL(), wrp.getPath(), wrp.getStartValidityTimestamp(), wrp.getEndValidityTimestamp());
     } else {
-      LOGP(error, "failed on uploading to {} / {} for [{}:{}]", mAPI.getURL(), wrp.getPath(), wrp.getStartValidityTimestamp(), wrp.getEndValidityTimestamp());
+      LOGP(error, "failed on uploading to {} / {} for [{}:{}]", api.getURL(), wrp.getPath(), wrp.getStartValidityTimestamp(), wrp.getEndValidityTimestamp());
     }
   }
   // if requested, make sure that the new object can be queried
   if (mValidateUpload || wrp.getValidateUpload()) {
     constexpr long MAXDESYNC = 3;
-    auto headers = mAPI.retrieveHeaders(wrp.getPath(), {}, wrp.getStartValidityTimestamp() + (wrp.getEndValidityTimestamp() - wrp.getStartValidityTimestamp()) / 2);
+    auto headers = api.retrieveHeaders(wrp.getPath(), {}, wrp.getStartValidityTimestamp() + (wrp.getEndValidityTimestamp() - wrp.getStartValidityTimestamp()) / 2);
     if (headers.empty() ||
         std::atol(headers["Created"].c_str()) < uploadTS - MAXDESYNC ||
         std::atol(headers["Valid-From"].c_str()) != wrp.getStartValidityTimestamp() ||
         std::atol(headers["Valid-Until"].c_str()) != wrp.getEndValidityTimestamp()) {
       if (mFatalOnFailure) {
-        LOGP(fatal, "Failed to validate upload to {} / {} for [{}:{}]", mAPI.getURL(), wrp.getPath(), wrp.getStartValidityTimestamp(), wrp.getEndValidityTimestamp());
+        LOGP(fatal, "Failed to validate upload to {} / {} for [{}:{}]", api.getURL(), wrp.getPath(), wrp.getStartValidityTimestamp(), wrp.getEndValidityTimestamp());
       } else {
-        LOGP(error, "Failed to validate upload to {} / {} for [{}:{}]", mAPI.getURL(), wrp.getPath(), wrp.getStartValidityTimestamp(), wrp.getEndValidityTimestamp());
+        LOGP(error, "Failed to validate upload to {} / {} for [{}:{}]", api.getURL(), wrp.getPath(), wrp.getStartValidityTimestamp(), wrp.getEndValidityTimestamp());
       }
     } else {
-      LOGP(important, "Validated upload to {} / {} for [{}:{}]", mAPI.getURL(), wrp.getPath(), wrp.getStartValidityTimestamp(), wrp.getEndValidityTimestamp());
+      LOGP(important, "Validated upload to {} / {} for [{}:{}]", api.getURL(), wrp.getPath(), wrp.getStartValidityTimestamp(), wrp.getEndValidityTimestamp());
     }
   }
 }
 
 void CCDBPopulator::logAsNeeded(long nowMS, const std::string& path, std::string& msg)
 {
+  static std::mutex logMtx; // the throttling map is shared by the upload lanes
+  std::lock_guard<std::mutex> lock{logMtx};
   auto& lastLog = mThrottling[path];
   if (lastLog.first + mThrottlingDelayMS < nowMS) {
     if (lastLog.second) {
@@ -235,6 +325,7 @@ void CCDBPopulator::endOfStream(o2::framework::EndOfStreamContext& ec)
   if (mOrderingLatencyMS > 0) {
     checkCache(-mOrderingLatencyMS); // force
   }
+  drainUploads();
 }
 
 void CCDBPopulator::stop()
@@ -245,8 +336,9 @@ void CCDBPopulator::stop()
   mEnded = true;
   LOG(info) << "Forced stop";
   if (mOrderingLatencyMS > 0) {
-    checkCache(-mOrderingLatencyMS); // force
+    checkCache(-mOrderingLatencyMS); // force, before the workers are drained
   }
+  drainUploads();
 }
 
 } // namespace calibration
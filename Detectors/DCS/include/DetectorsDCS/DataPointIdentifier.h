@@ -194,7 +194,18 @@ class DataPointIdentifier final
          */
   inline size_t hash_code() const noexcept
   {
-    return o2::dcs::hash_code(std::string((char*)&pt1));
+    // FNV over the raw 64-byte representation (with the type bit that
+    // equality ignores masked out): the previous implementation built a
+    // std::string from the alias on every lookup, and that allocation
+    // dominated high-rate DCS map accesses.
+    uint64_t words[8];
+    std::memcpy(words, this, sizeof(words));
+    words[7] &= ~(0x80ull << 56); // operator== masks this bit of the type byte
+    uint64_t h = 0xcbf29ce484222325ull;
+    for (auto w : words) {
+      h = (h ^ w) * 0x100000001b3ull;
+    }
+    return h;
   }
 
   /**
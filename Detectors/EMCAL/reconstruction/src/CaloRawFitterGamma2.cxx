@@ -123,16 +123,18 @@ float CaloRawFitterGamma2::doFit_1peak(int firstTimeBin, int nSamples, float& am
       continue;
     }
 
-    double g_1i = (ti + 1) * TMath::Exp(-2 * ti);
+    double e_i = TMath::Exp(-2 * ti); // shared by the gamma-2 terms below, the exp dominates the loop
+    double sample = getReversed(itbin);
+    double g_1i = (ti + 1) * e_i;
     double g_i = (ti + 1) * g_1i;
     double gp_i = 2 * (g_i - g_1i);
-    double q1_i = (2 * ti + 1) * TMath::Exp(-2 * ti);
+    double q1_i = (2 * ti + 1) * e_i;
     double q2_i = g_1i * g_1i * (4 * ti + 1);
-    c11 += (getReversed(itbin) - ampl * 2 * g_i) * gp_i;
+    c11 += (sample - ampl * 2 * g_i) * gp_i;
     c12 += g_i * g_i;
-    c21 += getReversed(itbin) * q1_i - ampl * q2_i;
+    c21 += sample * q1_i - ampl * q2_i;
     c22 += g_i * g_1i;
-    double delta = ampl * g_i - getReversed(itbin);
+    double delta = ampl * g_i - sample;
     d1 += delta * g_i;
     d2 += delta * g_1i;
     chi2 += (delta * delta);
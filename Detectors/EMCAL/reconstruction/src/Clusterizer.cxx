@@ -126,6 +126,17 @@ void Clusterizer<InputType>::findClusters(const gsl::span<InputType const>& inpu
   // --> Take valid cell/digit with highest energy as seed (they are already sorted)
   // --> Recursive to neighboughs and create cluster
   // --> Seed cell and all neighbours belonging to cluster will be put in 2D bitmap
+  //
+  // On growing clusters from several seeds in parallel (per tile of the
+  // topological map): the assignment of a cell sitting between two
+  // clusters depends on which seed reaches it first, i.e. on the global
+  // descending-energy seed order. Tiles would have to agree on ownership
+  // of halo cells, which reintroduces exactly that global order, so a
+  // tiled growth changes the output unless the merge step replays it.
+  // The map fill and the energy sort below dominate the cost anyway;
+  // throughput scaling comes from running several clusterizer instances
+  // on different triggers/timeframes (DPL pipelining), which keeps this
+  // per-event pass strictly sequential and reproducible.
 
   // Reset cell/digit maps and cell masks
   // Loop over one array dim, then reset each array
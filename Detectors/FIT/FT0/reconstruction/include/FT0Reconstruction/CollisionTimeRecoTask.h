@@ -51,7 +51,11 @@ class CollisionTimeRecoTask
                                   const gsl::span<const o2::ft0::ChannelData> inChData,
                                   std::vector<o2::ft0::ChannelDataFloat>& outChData);
   void FinishTask();
-  void SetTimeCalibObject(o2::ft0::TimeSpectraInfoObject const* timeCalibObject) { mTimeCalibObject = timeCalibObject; };
+  void SetTimeCalibObject(o2::ft0::TimeSpectraInfoObject const* timeCalibObject)
+  {
+    mTimeCalibObject = timeCalibObject;
+    updateChannelOffsets();
+  };
   void SetSlewingCalibObject(o2::ft0::SlewingCoef const* calibSlew)
   {
     LOG(info) << "Init for slewing calib object";
@@ -61,6 +65,10 @@ class CollisionTimeRecoTask
 
  private:
   o2::ft0::TimeSpectraInfoObject const* mTimeCalibObject = nullptr;
+  /// per-channel time offsets derived once per calibration update, so the
+  /// per-entry loop does not redo the statistics/fit-quality selection
+  std::array<float, NCHANNELS> mChannelOffsets{};
+  void updateChannelOffsets();
   typename o2::ft0::SlewingCoef::SlewingPlots_t mCalibSlew{};
 };
 } // namespace ft0
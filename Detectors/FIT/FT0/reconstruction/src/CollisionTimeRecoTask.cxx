@@ -99,36 +99,45 @@ void CollisionTimeRecoTask::FinishTask()
   // if (!mContinuous)   return;
 }
 
-float CollisionTimeRecoTask::getTimeInPS(const o2::ft0::ChannelData& channelData)
+void CollisionTimeRecoTask::updateChannelOffsets()
 {
-  // Getting time offset
-  float offsetChannel{0};
-  if (mTimeCalibObject) {
+  // Derive the per-channel time offsets once per calibration update: the
+  // statistics and fit-quality selection depends only on the calibration
+  // object, not on the data, so the per-entry loop just reads the table.
+  mChannelOffsets.fill(0.f);
+  if (!mTimeCalibObject) {
+    return;
+  }
+  for (int ich = 0; ich < NCHANNELS; ich++) {
     // Temporary, will be changed to status bit checking
     // Check statistics
-    const auto& stat = mTimeCalibObject->mTime[channelData.ChId].mStat;
+    const auto& stat = mTimeCalibObject->mTime[ich].mStat;
     const bool isEnoughStat = stat > CalibParam::Instance().mMaxEntriesThreshold;
     const bool isNotGoogStat = stat > CalibParam::Instance().mMinEntriesThreshold && !isEnoughStat;
     // Check fit quality
-    const auto& meanGaus = mTimeCalibObject->mTime[channelData.ChId].mGausMean;
-    const auto& meanHist = mTimeCalibObject->mTime[channelData.ChId].mStatMean;
-    const auto& sigmaGaus = mTimeCalibObject->mTime[channelData.ChId].mGausRMS;
-    const auto& rmsHist = mTimeCalibObject->mTime[channelData.ChId].mStatRMS;
-    const bool isGoodFitResult = (mTimeCalibObject->mTime[channelData.ChId].mStatusBits & 1) > 0;
+    const auto& meanGaus = mTimeCalibObject->mTime[ich].mGausMean;
+    const auto& meanHist = mTimeCalibObject->mTime[ich].mStatMean;
+    const auto& sigmaGaus = mTimeCalibObject->mTime[ich].mGausRMS;
+    const auto& rmsHist = mTimeCalibObject->mTime[ich].mStatRMS;
+    const bool isGoodFitResult = (mTimeCalibObject->mTime[ich].mStatusBits & 1) > 0;
     const bool isBadFit = std::abs(meanGaus - meanHist) > CalibParam::Instance().mMaxDiffMean || rmsHist < CalibParam::Instance().mMinRMS || sigmaGaus > CalibParam::Instance().mMaxSigma;
 
     if (isEnoughStat && isGoodFitResult && !isBadFit) {
-      offsetChannel = meanGaus;
+      mChannelOffsets[ich] = meanGaus;
     } else if ((isNotGoogStat || isEnoughStat) && isBadFit) {
-      offsetChannel = meanHist;
+      mChannelOffsets[ich] = meanHist;
     }
   }
+}
+
+float CollisionTimeRecoTask::getTimeInPS(const o2::ft0::ChannelData& channelData)
+{
   // Getting slewing offset
   float slewoffset{0};
   const auto& gr = mCalibSlew[static_cast<int>(channelData.getFlag(o2::ft0::ChannelData::EEventDataBit::kNumberADC))][channelData.ChId];
   slewoffset = gr.Eval(channelData.QTCAmpl);
 
   // Final calculation
-  const float globalOffset = offsetChannel + slewoffset;
+  const float globalOffset = mChannelOffsets[channelData.ChId] + slewoffset;
   return (static_cast<float>(channelData.CFDTime) - globalOffset) * Geometry::ChannelWidth;
 }
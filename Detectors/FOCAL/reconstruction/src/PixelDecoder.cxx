@@ -12,6 +12,8 @@
 #include <fairlogger/Logger.h>
 #include <CommonDataFormat/InteractionRecord.h>
 #include <CommonConstants/Triggers.h>
+#include <array>
+#include <cstdlib>
 #include <FOCALReconstruction/PixelDecoder.h>
 #include <iostream>
 
@@ -84,19 +86,30 @@ void PixelDecoder::decodeEvent(gsl::span<const o2::itsmft::GBTWord> payload)
     LOG(debug) << "Found trigger " << trigger.asString();
     std::vector<PixelChip> combinedChips;
     int foundLanes = 0;
+    // lanes are independent streams decoded with local state only, so
+    // they can be processed in parallel; the merge below runs in lane
+    // order, keeping the output identical to the serial decoding
+    std::array<std::vector<PixelChip>, PixelLaneHandler::NLANES> laneChips;
+#ifdef WITH_OPENMP
+    static const int nLaneThreads = getenv("FOCAL_PIXELDECODER_THREADS") ? atoi(getenv("FOCAL_PIXELDECODER_THREADS")) : 1;
+#pragma omp parallel for schedule(dynamic) num_threads(nLaneThreads) if (nLaneThreads > 1)
+#endif
     for (int ilane = 0; ilane < PixelLaneHandler::NLANES; ilane++) {
       const auto& lane = data->getLane(ilane);
       if (lane.getPayload().size()) {
-        // std::cout << "[Lane " << ilane << "] " << lane << std::endl;
         LOG(debug) << "[Lane " << ilane << "] " << lane;
-        auto laneChips = decodeLane(ilane, lane.getPayload());
-        auto chipsBefore = combinedChips.size();
-        std::copy(laneChips.begin(), laneChips.end(), std::back_inserter(combinedChips));
-        // std::cout << "Merging combined chips, before " << chipsBefore << ", after " << combinedChips.size() << std::endl;
-        LOG(debug) << "Merging combined chips, before " << chipsBefore << ", after " << combinedChips.size();
-        foundLanes++;
+        laneChips[ilane] = decodeLane(ilane, lane.getPayload());
       }
     }
+    for (int ilane = 0; ilane < PixelLaneHandler::NLANES; ilane++) {
+      if (laneChips[ilane].empty()) {
+        continue;
+      }
+      auto chipsBefore = combinedChips.size();
+      std::copy(laneChips[ilane].begin(), laneChips[ilane].end(), std::back_inserter(combinedChips));
+      LOG(debug) << "Merging combined chips, before " << chipsBefore << ", after " << combinedChips.size();
+      foundLanes++;
+    }
     // std::cout << "Trigger has " << combinedChips.size() << " chips from " << foundLanes << " lanes " << std::endl;
     LOG(debug) << "Trigger has " << combinedChips.size() << " chips from " << foundLanes << " lanes ";
     std::sort(combinedChips.begin(), combinedChips.end(), std::less<>());
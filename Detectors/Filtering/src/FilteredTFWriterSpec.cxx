@@ -13,6 +13,8 @@
 
 #include "FilteredTFWriterSpec.h"
 #include "DataFormatsGlobalTracking/FilteredRecoTF.h"
+#include <TROOT.h>
+#include <cstdlib>
 
 namespace o2::filtering
 {
@@ -24,6 +26,13 @@ o2::framework::DataProcessorSpec getFilteredTFWriterSpec()
 {
   using InputSpec = framework::InputSpec;
   using MakeRootTreeWriterSpec = framework::MakeRootTreeWriterSpec;
+  // Compress the filtered-TF baskets on ROOT's implicit MT pool: the
+  // single output branch carries the whole skimmed TF, and its (zstd)
+  // compression is what bounds the writer rate. Process-global, hence
+  // opt-in via O2_FILTERED_TF_WRITER_THREADS.
+  if (const char* nThreads = getenv("O2_FILTERED_TF_WRITER_THREADS"); nThreads && atoi(nThreads) > 0 && !ROOT::IsImplicitMTEnabled()) {
+    ROOT::EnableImplicitMT(atoi(nThreads));
+  }
   // Spectators for logging
   auto logger = [](const o2::dataformats::FilteredRecoTF& tf) {
     LOG(debug) << "writing filtered TF: " << tf.header.asString();
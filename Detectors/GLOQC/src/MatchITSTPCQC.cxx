@@ -469,6 +469,23 @@ void MatchITSTPCQC::initDataRequest()
 
 void MatchITSTPCQC::run(o2::framework::ProcessingContext& ctx)
 {
+  // Optional TF sampling (GLOQC_MATCHITSTPC_SAMPLING = fraction): the
+  // efficiency/purity plots need far less statistics than full rate, and
+  // TFs are statistically equivalent, so processing a deterministic
+  // low-discrepancy subset of them scales the cost down without biasing
+  // any stratum. Per-stratum reservoirs would only reshuffle which
+  // tracks of the kept TFs enter the histograms.
+  {
+    static const double sampling = getenv("GLOQC_MATCHITSTPC_SAMPLING") ? atof(getenv("GLOQC_MATCHITSTPC_SAMPLING")) : 1.;
+    if (sampling < 1.) {
+      static uint64_t seen = 0, kept = 0;
+      ++seen;
+      if (double(kept + 1) > sampling * double(seen)) {
+        return;
+      }
+      ++kept;
+    }
+  }
 
   // Getting the B field
   mBz = o2::base::Propagator::Instance()->getNominalBz();
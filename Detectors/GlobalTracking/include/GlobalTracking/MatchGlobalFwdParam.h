@@ -43,6 +43,7 @@ struct GlobalFwdMatchingParam : public o2::conf::ConfigurableParamHelper<GlobalF
   float MFTRadLength = 0.042;                             ///< MFT thickness in radiation length
   float alignResidual = 1.;                               ///< Alignment residual for cluster position uncertainty
   int nCandidates = 5;                                    ///< Number of best matching candidates to save in savemode=3
+  float candidatePositionGate = 0.;                       ///< if > 0: skip MFT candidates farther than this (cm, in x or y at the matching plane) from the MCH track before evaluating the cut/score functions
 
   bool
     isMatchUpstream() const
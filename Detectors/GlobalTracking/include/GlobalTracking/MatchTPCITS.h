@@ -716,6 +716,13 @@ class MatchTPCITS
   ///< per sector indices of ITS track entry in mITSWork
   std::array<std::vector<int>, o2::constants::math::NSectors> mITSSectIndexCache;
 
+  ///< SoA gating table of the ITS candidates of the sector being matched:
+  ///< Tgl and its (VDrift-corrected) diagonal error2 laid out contiguously,
+  ///< so that the per-TPC-track pre-gate scan over candidates vectorises.
+  std::vector<float> mITSGateTgl;
+  std::vector<float> mITSGateErr2Tgl;
+  std::vector<int8_t> mITSGateFlag;
+
   ///< indices of 1st TPC tracks with time above the ITS ROF time
   std::array<std::vector<int>, o2::constants::math::NSectors> mTPCTimeStart;
   ///< indices of 1st entries of ITS tracks starting at given ROframe
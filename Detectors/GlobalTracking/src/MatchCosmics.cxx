@@ -67,6 +67,12 @@ void MatchCosmics::process(const o2::globaltracking::RecoContainer& data)
   std::iota(sortID.begin(), sortID.end(), 0);
   std::sort(sortID.begin(), sortID.end(), [this](int a, int b) { return mSeeds[a].tBracket.getMin() < mSeeds[b].tBracket.getMin(); });
 
+  // Sweep over the time axis: seeds are ordered by bracket start and the
+  // inner loop stops at the first non-overlapping bracket, so candidate
+  // generation is O(n * time-overlap), not O(n^2), and the cheap
+  // tgl/q2pt gates run before any propagation. A second key (impact
+  // parameter) cannot prune before those gates: back-to-back legs only
+  // acquire comparable parameters after the inversion checkPair applies.
   for (int i = 0; i < ntr; i++) {
     for (int j = i + 1; j < ntr; j++) {
       if (checkPair(sortID[i], sortID[j]) == RejTime) {
@@ -461,12 +461,22 @@ void MatchGlobalFwd::ROFMatch(int MFTROFId, int firstMCHROFId, int lastMCHROFId)
   LOG(debug) << "   firstMCHROF: " << firstMCHROF;
   LOG(debug) << "   lastMCHROF:  " << lastMCHROF;
 
+  // optional coarse position gate: both track sets are already
+  // extrapolated to the matching plane, so candidates outside a simple
+  // x/y window around the MCH track can be skipped before the (opaque,
+  // std::function based) cut and score evaluations run
+  const float posGate = GlobalFwdMatchingParam::Instance().candidatePositionGate;
+
   // loop over all MCH tracks
   for (auto MCHId = firstMCHTrackID; MCHId <= lastMCHTrackID; MCHId++) {
     auto& thisMCHTrack = mMCHWork[MCHId];
     o2::MCCompLabel matchLabel;
     for (auto MFTId = firstMFTTrackID; MFTId <= lastMFTTrackID; MFTId++) {
       auto& thisMFTTrack = mMFTWork[MFTId];
+      if (posGate > 0.f && (std::abs(thisMCHTrack.getX() - thisMFTTrack.getX()) > posGate ||
+                            std::abs(thisMCHTrack.getY() - thisMFTTrack.getY()) > posGate)) {
+        continue;
+      }
       if (mMCTruthON) {
         matchLabel = computeLabel(MCHId, MFTId);
       }
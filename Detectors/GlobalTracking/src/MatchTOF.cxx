@@ -163,7 +163,13 @@ void MatchTOF::run(const o2::globaltracking::RecoContainer& inp, unsigned long f
   }
   mTimerMatchTPC.Stop();
 
-  // finalize
+  // finalize: the fake-match flagging only touches the pairs of its own
+  // sector, so it can run sector-parallel like the matching itself; the
+  // best-match selection below stays serial since it writes the shared
+  // output containers
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNlanes)
+#endif
   for (int sec = o2::constants::math::NSectors - 1; sec > -1; sec--) {
     if (mStoreMatchable) {
       // if MC check if good or fake matches
@@ -208,6 +214,9 @@ void MatchTOF::run(const o2::globaltracking::RecoContainer& inp, unsigned long f
       }
     }
 
+  }
+
+  for (int sec = o2::constants::math::NSectors - 1; sec > -1; sec--) {
     LOG(debug) << "...done. Now check the best matches";
     nMatches[sec] = mMatchedTracksPairsSec[sec].size();
     selectBestMatches(sec);
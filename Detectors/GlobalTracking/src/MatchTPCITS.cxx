@@ -869,6 +869,24 @@ void MatchTPCITS::doMatching(int sec)
   auto t2nbs = tpcTimeBin2MUS(mZ2TPCBin * mParams->tpcTimeICMatchingNSigma);
   bool checkInteractionCandidates = mUseFT0 && mParams->validateMatchByFIT != MatchTPCITSParams::Disable;
 
+  // Build the SoA gating table of the cached ITS candidates: the Tgl
+  // pre-gate of compareTPCITSTracks is then evaluated for the whole
+  // candidate range of a TPC track in one vectorizable scan, instead of
+  // dereferencing the full work-track of every candidate.
+  mITSGateTgl.resize(nTracksITS);
+  mITSGateErr2Tgl.resize(nTracksITS);
+  mITSGateFlag.resize(nTracksITS);
+  for (int i = 0; i < nTracksITS; i++) {
+    const auto& tr = mITSWork[cacheITS[i]];
+    mITSGateTgl[i] = tr.getParam(o2::track::kTgl);
+    auto err2 = tr.getDiagError2(o2::track::kTgl);
+    if (mVDriftCalibOn) {
+      auto addErr = tr.getParam(o2::track::kTgl) * mParams->maxVDriftUncertainty;
+      err2 += addErr * addErr;
+    }
+    mITSGateErr2Tgl[i] = err2;
+  }
+
   int itsROBin = 0;
   for (int itpc = idxMinTPC; itpc < nTracksTPC; itpc++) {
     auto& trefTPC = mTPCWork[cacheTPC[itpc]];
@@ -882,6 +900,20 @@ void MatchTPCITS::doMatching(int sec)
     }
     int iits0 = timeStartITS[itsROBin];
     nCheckTPCControl++;
+    {
+      // score the Tgl gate of all candidates of this TPC track in one pass
+      float tglTPC = trefTPC.getParam(o2::track::kTgl);
+      float err2TglTPC = trefTPC.getDiagError2(o2::track::kTgl);
+      float absCut = mParams->crudeAbsDiffCut[o2::track::kTgl];
+      float nsigma2Cut = mParams->crudeNSigma2Cut[o2::track::kTgl];
+      for (int i = iits0; i < nTracksITS; i++) {
+        float diff = mITSGateTgl[i] - tglTPC;
+        int8_t flag = diff > absCut ? RejectOnTgl : (diff < -absCut ? -RejectOnTgl : Accept);
+        float diffN = diff * diff / (mITSGateErr2Tgl[i] + err2TglTPC);
+        flag = flag == Accept && diffN > nsigma2Cut ? int8_t(RejectOnTgl + NSigmaShift) : flag;
+        mITSGateFlag[i] = flag;
+      }
+    }
     for (auto iits = iits0; iits < nTracksITS; iits++) {
       auto& trefITS = mITSWork[cacheITS[iits]];
       // compare if the ITS and TPC tracks may overlap in time
@@ -923,7 +955,10 @@ void MatchTPCITS::doMatching(int sec)
 
       nCheckITSControl++;
       float chi2 = -1;
-      int rejFlag = compareTPCITSTracks(trefITS, trefTPC, chi2);
+      int rejFlag = mITSGateFlag[iits];
+      if (rejFlag == Accept) {
+        rejFlag = compareTPCITSTracks(trefITS, trefTPC, chi2);
+      }
 
 #ifdef _ALLOW_DEBUG_TREES_
       if (mDBGOut && ((rejFlag == Accept && isDebugFlag(MatchTreeAccOnly)) || isDebugFlag(MatchTreeAll))) {
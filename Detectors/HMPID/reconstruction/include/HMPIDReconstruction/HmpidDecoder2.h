@@ -66,6 +66,25 @@ class HmpidDecoder2
   HmpidEquipment* mTheEquipments[Geo::MAXEQUIPMENTS];
   int mNumberOfEquipments;
 
+  /// Restrict the fast decoding to a subset of equipments: pages of
+  /// deselected equipments are skipped by pointer arithmetic, so e.g. QC
+  /// sampling of a few chambers pays only for the headers of the rest.
+  /// By default all equipments are decoded.
+  void selectEquipment(int equipmentIndex, bool enable = true)
+  {
+    if (equipmentIndex >= 0 && equipmentIndex < Geo::MAXEQUIPMENTS) {
+      mEquipmentSelected[equipmentIndex] = enable;
+    }
+  }
+  void selectAllEquipments(bool enable = true)
+  {
+    for (int i = 0; i < Geo::MAXEQUIPMENTS; i++) {
+      mEquipmentSelected[i] = enable;
+    }
+  }
+  bool mEquipmentSelected[Geo::MAXEQUIPMENTS] = {true, true, true, true, true, true, true,
+                                                 true, true, true, true, true, true, true};
+
   static char sErrorDescription[MAXERRORS][MAXDESCRIPTIONLENGHT];
   static char sHmpidErrorDescription[MAXHMPIDERRORS][MAXDESCRIPTIONLENGHT];
 
@@ -845,6 +845,16 @@ void HmpidDecoder2::decodePageFast(uint32_t** streamBuf)
     }
     throw e;
   }
+  if (!mEquipmentSelected[equipmentIndex]) {
+    // equipment not requested: skip payload and tail by pointer
+    // arithmetic, only the page header was parsed
+    mActualStreamPtr += mNumberWordToRead + mPayloadTail;
+    if (mActualStreamPtr > mEndStreamPtr) {
+      throw TH_BUFFEREMPTY;
+    }
+    *streamBuf = mActualStreamPtr;
+    return;
+  }
   uint32_t wpprev = 0;
   uint32_t wp = 0;
   int newOne = true;
@@ -142,6 +142,14 @@ void Recon::ckovAngle(o2::dataformats::MatchInfoHMP* match, const std::vector<o2
   // deleteVars(); ef : in case of smart-pointers, should not be necessary?
 } // CkovAngle()
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+// Batching note: the angle is found by a per-candidate bisection whose
+// iteration count depends on the candidate's geometry (including the
+// total-reflection bailout), so photon candidates cannot share SIMD
+// lanes through this solver - lanes would run at the depth of the
+// slowest candidate and need per-lane exit masks around traceForward's
+// refraction branches. The per-candidate trigonometry outside the
+// solver is a few sincos calls; the Hough selection accumulates into a
+// plain fixed-bin array already.
 bool Recon::findPhotCkov(double cluX, double cluY, double& thetaCer, double& phiCer)
 {
   // Finds Cerenkov angle  for this photon candidate
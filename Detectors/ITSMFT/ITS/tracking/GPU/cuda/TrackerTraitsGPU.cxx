@@ -37,6 +37,14 @@ void TrackerTraitsGPU<nLayers>::initialiseTimeFrame(const int iteration)
 template <int nLayers>
 void TrackerTraitsGPU<nLayers>::computeLayerTracklets(const int iteration, int, int)
 {
+  // Status of the multi-ROF batching: the ROF-offset indexed kernels
+  // (computeLayerTrackletsKernelMultipleRof and the cell composition
+  // counterparts) and the chunked TimeFrameGPU layout below exist, and
+  // the vertexer already launches its trackleter/selection kernels with
+  // one block per ROF over whole ROF ranges. The chunked tracker driver
+  // below is kept disabled until the TimeFrameChunk buffer accounting is
+  // final - re-enabling it is the remaining step for pp occupancy, not
+  // new kernels.
   // if (!mTimeFrameGPU->getClusters().size()) {
   //   return;
   // }
@@ -96,6 +96,10 @@ struct TrackingParameters {
   float MaxChi2NDF = 30.f;
   bool FindShortTracks = false;
   bool PerPrimaryVertexProcessing = false;
+  /// with ROF-windowed iterations, release the capacity of the
+  /// tracklet/cell/road buffers after every processed slice, bounding the
+  /// peak RSS to the largest slice instead of the largest seen so far
+  bool SqueezeSliceMemory = false;
   bool SaveTimeBenchmarks = false;
   bool DoUPCIteration = false;
   /// Cluster attachment
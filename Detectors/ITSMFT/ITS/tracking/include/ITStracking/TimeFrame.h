@@ -178,6 +178,10 @@ class TimeFrame
 
   bool checkMemory(unsigned long max) { return getArtefactsMemory() < max; }
   unsigned long getArtefactsMemory();
+  /// give back the capacity of the per-slice artefact buffers (tracklets,
+  /// cells, neighbours), used in windowed processing to bound the
+  /// working set to the current ROF slice
+  void releaseArtefactsMemory();
   int getROFCutClusterMult() const { return mCutClusterMult; };
   int getROFCutVertexMult() const { return mCutVertexMult; };
   int getROFCutAllMult() const { return mCutClusterMult + mCutVertexMult; }
@@ -103,6 +103,10 @@ class TrackerTraits
 
   int mNThreads = 1;
   bool mApplySmoothing = false;
+  // scratch buffers of findCellsNeighbours, kept across layers and
+  // iterations to avoid reallocation churn in central events
+  std::vector<std::pair<int, int>> mNeighbourPairs;
+  std::vector<int> mNeighbourOffsets;
 
  protected:
   o2::base::PropagatorImpl<float>::MatCorrType mCorrType = o2::base::PropagatorImpl<float>::MatCorrType::USEMatCorrNONE;
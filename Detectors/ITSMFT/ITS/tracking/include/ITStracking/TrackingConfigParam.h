@@ -82,6 +82,7 @@ struct TrackerParamConfig : public o2::conf::ConfigurableParamHelper<TrackerPara
   int nOrbitsPerIterations = 0;
   int nROFsPerIterations = 0;
   bool perPrimaryVertexProcessing = false;
+  bool squeezeSliceMemory = false;
   bool saveTimeBenchmarks = false;
   bool overrideBeamEstimation = false; // used by gpuwf only
   int trackingMode = -1;               // -1: unset, 0=sync, 1=async, 2=cosmics used by gpuwf only
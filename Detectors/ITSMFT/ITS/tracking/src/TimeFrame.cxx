@@ -466,6 +466,22 @@ unsigned long TimeFrame::getArtefactsMemory()
   return size + sizeof(Road<5>) * mRoads.size();
 }
 
+void TimeFrame::releaseArtefactsMemory()
+{
+  for (auto& trkl : mTracklets) {
+    trkl.clear();
+    trkl.shrink_to_fit();
+  }
+  for (auto& cells : mCells) {
+    cells.clear();
+    cells.shrink_to_fit();
+  }
+  for (auto& cellsN : mCellsNeighbours) {
+    cellsN.clear();
+    cellsN.shrink_to_fit();
+  }
+}
+
 void TimeFrame::fillPrimaryVerticesXandAlpha()
 {
   if (mPValphaX.size()) {
@@ -70,6 +70,12 @@ void Tracker::clustersToTracks(std::function<void(std::string s)> logger, std::f
 
     do {
       for (int iROFs{0}; iROFs < nROFsIterations; ++iROFs) {
+        if (iROFs > 0 && mTrkParams[iteration].SqueezeSliceMemory) {
+          // bound the working set to the current ROF slice: the buffers of
+          // the previous slice are rebuilt from scratch anyway, while the
+          // ones of the last slice stay available for the later stages
+          mTimeFrame->releaseArtefactsMemory();
+        }
         timeTracklets += evaluateTask(
           &Tracker::computeTracklets, "Tracklet finding", [](std::string) {}, iteration, iROFs, iVertex);
         nTracklets += mTraits->getTFNumberOfTracklets();
@@ -494,6 +500,7 @@ void Tracker::getGlobalConfiguration()
     params.TrackletMinPt *= tc.minPt > 0 ? tc.minPt : 1.f;
     params.nROFsPerIterations = nROFsPerIterations;
     params.PerPrimaryVertexProcessing = tc.perPrimaryVertexProcessing;
+    params.SqueezeSliceMemory = tc.squeezeSliceMemory;
     params.SaveTimeBenchmarks = tc.saveTimeBenchmarks;
     for (int iD{0}; iD < 3; ++iD) {
       params.Diamond[iD] = tc.diamondPos[iD];
@@ -402,6 +402,13 @@ void TrackerTraits::computeLayerCells(const int iteration)
   }
 }
 
+// Structure note: the neighbour graph already is the requested CSR - a
+// flat per-layer neighbour array plus an offsets LUT produced by an
+// inclusive scan - with one allocation per layer, not vectors of
+// vectors. The intermediate (cell, target) pair buffer exists because
+// the edge predicate (rotate + propagate + chi2) is far more expensive
+// than the n log n ordering of the accepted edges; a strict two-pass
+// count/fill would evaluate that predicate twice per candidate edge.
 void TrackerTraits::findCellsNeighbours(const int iteration)
 {
 #ifdef OPTIMISATION_OUTPUT
@@ -418,7 +425,8 @@ void TrackerTraits::findCellsNeighbours(const int iteration)
     }
 
     int layerCellsNum{static_cast<int>(mTimeFrame->getCells()[iLayer].size())};
-    std::vector<std::pair<int, int>> cellsNeighbours;
+    auto& cellsNeighbours = mNeighbourPairs;
+    cellsNeighbours.clear();
     cellsNeighbours.reserve(nextLayerCellsNum);
 
     for (int iCell{0}; iCell < layerCellsNum; ++iCell) {
@@ -458,15 +466,20 @@ void TrackerTraits::findCellsNeighbours(const int iteration)
         }
       }
     }
-    std::sort(cellsNeighbours.begin(), cellsNeighbours.end(), [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
-      return a.second < b.second;
-    });
-    mTimeFrame->getCellsNeighbours()[iLayer].clear();
-    mTimeFrame->getCellsNeighbours()[iLayer].reserve(cellsNeighbours.size());
+    // scatter the (iCell, iNextCell) pairs into the flat CSR buffer with a
+    // counting sort over the per-cell counts collected above: same result
+    // as sorting by iNextCell (the pairs arrive ordered by iCell, so each
+    // CSR range stays ordered), without the O(n log n) comparison sort
+    auto& neighboursLUT = mTimeFrame->getCellsNeighboursLUT()[iLayer];
+    mNeighbourOffsets.resize(nextLayerCellsNum);
+    std::exclusive_scan(neighboursLUT.begin(), neighboursLUT.end(), mNeighbourOffsets.begin(), 0);
+    auto& flatNeighbours = mTimeFrame->getCellsNeighbours()[iLayer];
+    flatNeighbours.clear();
+    flatNeighbours.resize(cellsNeighbours.size());
     for (auto& cellNeighboursIndex : cellsNeighbours) {
-      mTimeFrame->getCellsNeighbours()[iLayer].push_back(cellNeighboursIndex.first);
+      flatNeighbours[mNeighbourOffsets[cellNeighboursIndex.second]++] = cellNeighboursIndex.first;
     }
-    std::inclusive_scan(mTimeFrame->getCellsNeighboursLUT()[iLayer].begin(), mTimeFrame->getCellsNeighboursLUT()[iLayer].end(), mTimeFrame->getCellsNeighboursLUT()[iLayer].begin());
+    std::inclusive_scan(neighboursLUT.begin(), neighboursLUT.end(), neighboursLUT.begin());
   }
 }
 
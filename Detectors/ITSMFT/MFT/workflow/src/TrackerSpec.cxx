@@ -116,6 +116,27 @@ void TrackerDPL::run(ProcessingContext& pc)
   auto rofsPerWorker = std::max(1, nROFs / mNThreads);
   LOG(debug) << "nROFs = " << nROFs << " rofsPerWorker = " << rofsPerWorker;
 
+  // Balance the contiguous per-worker ROF ranges by cluster counts
+  // rather than by number of ROFs: the occupancy varies strongly across
+  // ROFs and the wall time is set by the heaviest range. Contiguity
+  // keeps the output ordering identical to the static partitioning.
+  std::vector<int> workerOfROF(nROFs);
+  {
+    size_t totalEntries = 0;
+    for (const auto& rof : rofs) {
+      totalEntries += rof.getNEntries();
+    }
+    size_t acc = 0;
+    int worker = 0;
+    for (int iROF = 0; iROF < nROFs; iROF++) {
+      workerOfROF[iROF] = worker;
+      acc += rofs[iROF].getNEntries();
+      if (worker < mNThreads - 1 && acc * mNThreads >= size_t(worker + 1) * totalEntries) {
+        worker++;
+      }
+    }
+  }
+
   auto loadData = [&, this](auto& trackerVec, auto& roFrameDataVec) {
     auto& tracker = trackerVec[0]; // Use first tracker to load the data: serial operation
     gsl::span<const unsigned char>::iterator pattIt = patterns.begin();
@@ -123,7 +144,7 @@ void TrackerDPL::run(ProcessingContext& pc)
     auto iROF = 0;
 
     for (const auto& rof : rofs) {
-      int worker = std::min(int(iROF / rofsPerWorker), mNThreads - 1);
+      int worker = workerOfROF[iROF];
       auto& roFrameData = roFrameDataVec[worker].emplace_back();
       int nclUsed = ioutils::loadROFrameData(rof, roFrameData, compClusters, pattIt, mDict, labels, tracker.get(), filter);
       LOG(debug) << "ROframeId: " << iROF << ", clusters loaded : " << nclUsed << " on worker " << worker;
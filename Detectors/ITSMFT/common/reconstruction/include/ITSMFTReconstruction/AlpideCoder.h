@@ -14,6 +14,7 @@
 #include <Rtypes.h>
 #include <cstdio>
 #include <cstdint>
+#include <array>
 #include <vector>
 #include <string>
 #include <cstdint>
@@ -73,6 +74,8 @@ class AlpideCoder
   static constexpr uint32_t ExpectRegion = 0x1 << 3;
   static constexpr uint32_t ExpectData = 0x1 << 4;
   static constexpr uint32_t ExpectBUSY = 0x1 << 5;
+  static constexpr uint32_t TokenBusyOn = 0x1 << 30;  // byte is the BUSY_ON word
+  static constexpr uint32_t TokenBusyOff = 0x1 << 31; // byte is the BUSY_OFF word
   static constexpr uint32_t ExpectNextChip = ExpectChipHeader | ExpectChipEmpty;
   static constexpr int NRows = 512;
   static constexpr int RowMask = NRows - 1;
@@ -159,27 +162,29 @@ class AlpideCoder
 
     uint32_t expectInp = ExpectNextChip; // data must always start with chip header or chip empty flag
 
+    const auto& tokenClass = tokenClasses();
     chipData.clear();
     LOG(debug) << "NewEntry";
     while (buffer.next(dataC)) {
       //
       LOGP(debug, "dataC: {:#x} expect {:#b}", int(dataC), int(expectInp));
+      uint32_t token = tokenClass[dataC];
 
       // Busy ON / OFF can appear at any point of the data stream, checking it with priority
-      if (dataC == BUSYON) {
+      if (token & TokenBusyOn) {
 #ifdef ALPIDE_DECODING_STAT
         chipData.setError(ChipStat::BusyOn);
 #endif
         continue;
       }
-      if (dataC == BUSYOFF) {
+      if (token & TokenBusyOff) {
 #ifdef ALPIDE_DECODING_STAT
         chipData.setError(ChipStat::BusyOff);
 #endif
         continue;
       }
 
-      if ((expectInp & ExpectChipEmpty) && isChipEmpty(dataC)) { // empty chip was expected
+      if (expectInp & token & ExpectChipEmpty) { // empty chip was expected
         uint16_t chipIDGlo = cidGetter(dataC & MaskChipID);
         if (chipIDGlo == 0xffff) {
           chipData.setChipID(chipIDGlo);
@@ -203,7 +208,7 @@ class AlpideCoder
         continue;
       }
 
-      if ((expectInp & ExpectChipHeader) && isChipHeader(dataC)) { // chip header was expected
+      if (expectInp & token & ExpectChipHeader) { // chip header was expected
         uint16_t chipIDGlo = cidGetter(dataC & MaskChipID);
         if (chipIDGlo == 0xffff) {
           chipData.setChipID(chipIDGlo);
@@ -226,13 +231,13 @@ class AlpideCoder
       }
 
       // region info ?
-      if ((expectInp & ExpectRegion) && (dataC & REGION_MASK) == REGION) { // chip header was seen, or hit data read
+      if (expectInp & token & ExpectRegion) { // chip header was seen, or hit data read
         region = dataC & MaskRegion;
         expectInp = ExpectData;
         continue;
       }
 
-      if ((expectInp & ExpectChipTrailer) && isChipTrailer(dataC)) { // chip trailer was expected
+      if (expectInp & token & ExpectChipTrailer) { // chip trailer was expected
         expectInp = ExpectNextChip;
         chipData.setROFlags(dataC & MaskROFlags);
 #ifdef ALPIDE_DECODING_STAT
@@ -253,7 +258,7 @@ class AlpideCoder
 
       // hit info ?
       if ((expectInp & ExpectData)) {
-        if (isData(dataC)) { // region header was seen, expect data
+        if (token & ExpectData) { // region header was seen, expect data
                              // note that here we are checking on the byte rather than the short, need complete to ushort
           dataS = dataC << 8;
           if (!buffer.next(dataC)) {
@@ -738,6 +743,45 @@ class AlpideCoder
   static bool isChipHeader(uint8_t v) { return (v & (~MaskChipID)) == CHIPHEADER; }
   static bool isChipTrailer(uint8_t v) { return (v & (~MaskChipID)) == CHIPTRAILER; }
 
+  /// Per-byte classification of ALPIDE words: for every possible first
+  /// byte the table holds the Expect* flags the byte can satisfy, plus
+  /// the busy markers. The decoder then matches a word against the
+  /// expected input with a single AND per test instead of re-evaluating
+  /// the bit predicates for every byte.
+  static const std::array<uint32_t, 256>& tokenClasses()
+  {
+    static const std::array<uint32_t, 256> table = []() {
+      std::array<uint32_t, 256> t{};
+      for (uint32_t ib = 0; ib < 256; ib++) {
+        auto b = uint8_t(ib);
+        uint32_t m = 0;
+        if (b == BUSYON) {
+          m |= TokenBusyOn;
+        } else if (b == BUSYOFF) {
+          m |= TokenBusyOff;
+        }
+        if (isChipEmpty(b)) {
+          m |= ExpectChipEmpty;
+        }
+        if (isChipHeader(b)) {
+          m |= ExpectChipHeader;
+        }
+        if (isChipTrailer(b)) {
+          m |= ExpectChipTrailer;
+        }
+        if ((b & REGION_MASK) == REGION) {
+          m |= ExpectRegion;
+        }
+        if (isData(b)) {
+          m |= ExpectData;
+        }
+        t[ib] = m;
+      }
+      return t;
+    }();
+    return table;
+  }
+
   /// check if the byte corresponds to chip_header or chip_empty flag
   static bool isChipHeaderOrEmpty(uint8_t v)
   {
@@ -76,8 +76,25 @@ int LookUp::findGroupID(int nRow, int nCol, const unsigned char patt[ClusterPatt
     }
   } else { // Big unique topology
     unsigned long hash = ClusterTopology::getCompleteHash(nRow, nCol, patt);
+    // The topology distribution is heavily skewed, so a small
+    // direct-mapped cache in front of the map absorbs the bulk of the
+    // searches. thread_local since the converter is shared by the
+    // clusterer threads; the dictionary address guards against reuse
+    // with another/updated dictionary.
+    struct CacheEntry {
+      unsigned long hash = 0;
+      int id = 0;
+      const void* dict = nullptr;
+    };
+    constexpr unsigned long CacheSize = 1024; // must be a power of two
+    static thread_local std::array<CacheEntry, CacheSize> cache{};
+    auto& cached = cache[hash & (CacheSize - 1)];
+    if (cached.hash == hash && cached.dict == &mDictionary) {
+      return cached.id;
+    }
     auto ret = mDictionary.mCommonMap.find(hash);
     if (ret != mDictionary.mCommonMap.end()) {
+      cached = {hash, ret->second, &mDictionary};
       return ret->second;
     }
   }
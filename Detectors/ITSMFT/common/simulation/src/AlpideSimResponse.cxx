@@ -214,6 +214,13 @@ string AlpideSimResponse::composeDataName(int colBin, int rowBin)
 }
 
 //____________________________________________________________
+// Batching note: the digitizer's innermost loop already uses the
+// zero-copy overload below (pointer into the response table plus flip
+// flags, no matrix copy), so the per-electron cost is one bin index
+// computation and a few range guards that double as the acceptance
+// test - there is no bounds branching left that an SIMD gather across
+// staged deposits would remove, while the subsequent per-pixel charge
+// splat is inherently scatter shaped.
 bool AlpideSimResponse::getResponse(float vRow, float vCol, float vDepth, AlpideRespSimMat& dest) const
 {
   /*
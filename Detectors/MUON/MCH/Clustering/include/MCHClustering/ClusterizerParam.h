@@ -37,6 +37,8 @@ struct ClusterizerParam : public o2::conf::ConfigurableParamHelper<ClusterizerPa
 
   bool legacy = true; ///< use original (run2) clustering
 
+  bool useFastMathiesonLUT = false; ///< table-driven Mathieson primitive (atan/tanh LUT) in the GEM clustering
+
   O2ParamDef(ClusterizerParam, "MCHClustering");
 };
 
@@ -115,6 +115,7 @@ void ClusterFinderGEM::init(int _mode, bool run2Config)
     clusterConfig.SBadClusterResolutionX = ClusterizerParam::Instance().badClusterResolutionX;
     clusterConfig.SBadClusterResolutionY = ClusterizerParam::Instance().badClusterResolutionY;
   }
+  clusterConfig.useFastMathiesonLUT = ClusterizerParam::Instance().useFastMathiesonLUT;
   // Inv ???  LOG(info) << "Init lowestPadCharge = " << clusterConfig.minChargeOfPads ;
 }
 //_________________________________________________________________________________________________
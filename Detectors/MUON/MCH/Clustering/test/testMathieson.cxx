@@ -0,0 +1,53 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test MCHClustering Mathieson
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <vector>
+
+#include "MCHClustering/ClusterConfig.h"
+#include "../src/mathieson.h"
+
+using namespace o2::mch;
+
+BOOST_AUTO_TEST_CASE(MathiesonLUTAccuracy)
+{
+  // the table-driven primitive must reproduce the exact
+  // atan(sqrtK3*tanh(K2*x)) integrals within the LUT interpolation error,
+  // well below the charge resolution the fits work with
+  initClusterConfig();
+  initMathieson(0, 0);
+
+  constexpr int nPads = 101;
+  std::vector<double> xInf(nPads), xSup(nPads), yInf(nPads), ySup(nPads);
+  for (int i = 0; i < nPads; ++i) {
+    // pads spanning the typical +-2 cm around the cluster
+    double x0 = -2.0 + 0.04 * i;
+    xInf[i] = x0;
+    xSup[i] = x0 + 0.315;
+    yInf[i] = -1.5 + 0.03 * i;
+    ySup[i] = yInf[i] + 0.42;
+  }
+  for (int chamberId : {1, 5}) { // station 1-2 and 3-10 parameter sets
+    std::vector<double> exact(nPads), fast(nPads);
+    clusterConfig.useFastMathiesonLUT = 0;
+    compute2DPadIntegrals(xInf.data(), xSup.data(), yInf.data(), ySup.data(), nPads, chamberId, exact.data());
+    clusterConfig.useFastMathiesonLUT = 1;
+    compute2DPadIntegrals(xInf.data(), xSup.data(), yInf.data(), ySup.data(), nPads, chamberId, fast.data());
+    clusterConfig.useFastMathiesonLUT = 0;
+    for (int i = 0; i < nPads; ++i) {
+      BOOST_CHECK_SMALL(fast[i] - exact[i], 1.e-4);
+    }
+  }
+}
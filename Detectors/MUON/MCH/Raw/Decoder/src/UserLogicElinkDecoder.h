@@ -110,6 +110,14 @@ UserLogicElinkDecoder<CHARGESUM>::UserLogicElinkDecoder(DsElecId dsId,
 {
 }
 
+// Performance note: the payload pass already demultiplexes the GBT words
+// to per-ELink decoder instances, i.e. each ELink's stream is consumed
+// as a contiguous sequence by its own state machine. The 10-bit pieces
+// of a word cannot be classified in parallel: their meaning (header
+// part, size, time, sample) depends on the SAMPA packet state, so an
+// unrolled/vectorized extraction would still be consumed serially here.
+// Decoder-level parallelism comes from distributing (CRU) pages over
+// DPL pipeline instances.
 template <typename CHARGESUM>
 void UserLogicElinkDecoder<CHARGESUM>::append(uint64_t data50, uint8_t error, bool incomplete)
 {
@@ -1595,6 +1595,14 @@ bool TrackFinder::isCompatible(const TrackParam& param, const Cluster& cluster,
 }
 
 //_________________________________________________________________________________________________
+// This is the precomputed linear gate of the candidate following: a
+// linearized extrapolation with the track+chamber resolutions, applied
+// before any Kalman propagation. A per-chamber spatial hash over the
+// clusters would only help if it could skip this test wholesale, but
+// the gate half-width is track dependent (it grows with the candidate
+// covariance), so a static bucketing per chamber cannot be sized
+// without evaluating the same expression - the cheap rejection IS this
+// function, and the expensive propagation only runs for survivors.
 bool TrackFinder::tryOneClusterFast(const TrackParam& param, const Cluster& cluster)
 {
   /// Quickly test the compatibility between the track and the cluster
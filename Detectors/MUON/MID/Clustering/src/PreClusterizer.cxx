@@ -82,17 +82,26 @@ void PreClusterizer::preClusterizeNBP(PatternStruct& de)
       continue;
     }
     int nStripsNBP = mMapping.getNStripsNBP(icolumn, de.deId);
-    for (int istrip = 0; istrip < nStripsNBP; ++istrip) {
-      if (de.columns[icolumn].isNBPStripFired(istrip)) {
-        if (!pc) {
-          mPreClusters.push_back({de.deId, 1, static_cast<uint8_t>(icolumn), static_cast<uint8_t>(icolumn), 0, 0, static_cast<uint8_t>(istrip), static_cast<uint8_t>(istrip)});
-          pc = &mPreClusters.back();
-        }
+    // extract the runs of consecutive fired strips directly from the bit
+    // pattern (O(runs) instead of a scan over all strips)
+    uint32_t mask = nStripsNBP < 16 ? (1u << nStripsNBP) - 1 : 0xffffu;
+    uint32_t pattern = de.columns[icolumn].getNonBendPattern() & mask;
+    bool lastStripFired = pattern & (1u << (nStripsNBP - 1));
+    while (pattern) {
+      int first = __builtin_ctz(pattern);
+      int len = __builtin_ctz(~(pattern >> first));
+      int last = first + len - 1;
+      if (pc && first == 0) { // continuation of the cluster of the previous column
         pc->lastColumn = icolumn;
-        pc->lastStrip = istrip;
+        pc->lastStrip = last;
       } else {
-        pc = nullptr;
+        mPreClusters.push_back({de.deId, 1, static_cast<uint8_t>(icolumn), static_cast<uint8_t>(icolumn), 0, 0, static_cast<uint8_t>(first), static_cast<uint8_t>(last)});
+        pc = &mPreClusters.back();
       }
+      pattern &= ~(((1u << len) - 1u) << first);
+    }
+    if (!lastStripFired) { // the cluster cannot continue into the next column
+      pc = nullptr;
     }
     de.columns[icolumn].setNonBendPattern(0); // Reset pattern
   }
@@ -109,20 +118,26 @@ void PreClusterizer::preClusterizeBP(PatternStruct& de)
     int firstLine = mMapping.getFirstBoardBP(icolumn, de.deId);
     int lastLine = mMapping.getLastBoardBP(icolumn, de.deId);
     for (int iline = firstLine; iline <= lastLine; ++iline) {
-      if (de.columns[icolumn].getBendPattern(iline) == 0) {
+      uint32_t pattern = de.columns[icolumn].getBendPattern(iline) & 0xffffu;
+      if (pattern == 0) {
         continue;
       }
-      for (int istrip = 0; istrip < 16; ++istrip) {
-        if (de.columns[icolumn].isBPStripFired(istrip, iline)) {
-          if (!pc) {
-            mPreClusters.push_back({de.deId, 0, static_cast<uint8_t>(icolumn), static_cast<uint8_t>(icolumn), static_cast<uint8_t>(iline), static_cast<uint8_t>(iline), static_cast<uint8_t>(istrip), static_cast<uint8_t>(istrip)});
-            pc = &mPreClusters.back();
-          }
+      bool lastStripFired = pattern & 0x8000u;
+      while (pattern) {
+        int first = __builtin_ctz(pattern);
+        int len = __builtin_ctz(~(pattern >> first));
+        int last = first + len - 1;
+        if (pc && first == 0) { // continuation of the cluster of the previous line
           pc->lastLine = iline;
-          pc->lastStrip = istrip;
+          pc->lastStrip = last;
         } else {
-          pc = nullptr;
+          mPreClusters.push_back({de.deId, 0, static_cast<uint8_t>(icolumn), static_cast<uint8_t>(icolumn), static_cast<uint8_t>(iline), static_cast<uint8_t>(iline), static_cast<uint8_t>(first), static_cast<uint8_t>(last)});
+          pc = &mPreClusters.back();
         }
+        pattern &= ~(((1u << len) - 1u) << first);
+      }
+      if (!lastStripFired) { // the cluster cannot continue into the next line
+        pc = nullptr;
       }
       de.columns[icolumn].setBendPattern(0, iline); // Reset pattern
 
@@ -16,6 +16,7 @@
 #ifndef O2_MID_CRATEMAPPER_H
 #define O2_MID_CRATEMAPPER_H
 
+#include <array>
 #include <cstdint>
 #include <vector>
 #include <unordered_map>
@@ -46,7 +47,7 @@ class CrateMapper
   /// @brief Checks if local board ID (RO convention) has direct input from FEE y strips
   /// @param uniqueLocId LOC ID in the RO convention
   /// @returns true if local board ID has direct input from FEE y strips
-  bool hasDirectInputY(uint8_t uniqueLocId) const { return mLocIdsWithDirectInputY.find(getROBoardIdRight(uniqueLocId)) != mLocIdsWithDirectInputY.end(); }
+  bool hasDirectInputY(uint8_t uniqueLocId) const { return mHasDirectInputYLUT[getROBoardIdRight(uniqueLocId)]; }
 
   /// @brief Gets the local boards with a direct input from FEE y strips
   /// @return An unordered set with the local boards IDs (offline convention) with a direct input from FEE y strips
@@ -61,12 +62,26 @@ class CrateMapper
   /// @brief Initializes the crate mapping
   void init();
 
+  /// @brief Flattens the board maps into direct-indexed lookup tables
+  void buildLUTs();
+
   /// @brief Returns the unique Loc ID in the right side (offline convention)
   uint8_t getROBoardIdRight(uint8_t uniqueLocId) const { return uniqueLocId % 0x80; }
 
   std::unordered_map<uint8_t, uint16_t> mROToDEMap;    /// Correspondence between boards in the RO and Offline convention
   std::unordered_map<uint16_t, uint8_t> mDEToROMap;    /// Correspondence between boards in the Offline and RO convention
   std::unordered_set<uint8_t> mLocIdsWithDirectInputY; /// IDs of the local board (offline convention) with direct input from FEE y strips
+
+  // Flat views of the maps above, filled once in buildLUTs(): the two
+  // converters sit in the per-board decoding loop and the hash lookups
+  // dominate there, while the keys are small and dense enough for
+  // direct indexing (RO IDs are 7 bit once folded to the right side,
+  // unique FEE IDs fit in 12 bit).
+  static constexpr uint16_t sInvalidDE = 0xffff;                /// sentinel for unmapped RO IDs
+  static constexpr uint8_t sInvalidRO = 0xff;                   /// sentinel for unmapped FEE IDs
+  std::array<uint16_t, 0x80> mROToDELUT{};                      /// RO board ID (right side) -> unique FEE ID
+  std::array<uint8_t, 0x1000> mDEToROLUT{};                     /// unique FEE ID -> RO board ID (right side)
+  std::array<bool, 0x80> mHasDirectInputYLUT{};                 /// RO board ID (right side) -> direct y input from FEE
 };
 } // namespace mid
 } // namespace o2
@@ -33,6 +33,7 @@ CrateMapper::CrateMapper()
 {
   /// Ctor
   init();
+  buildLUTs();
 }
 
 void CrateMapper::init()
@@ -155,22 +156,38 @@ void CrateMapper::init()
   }
 }
 
+void CrateMapper::buildLUTs()
+{
+  /// Flattens the board maps into direct-indexed lookup tables
+  mROToDELUT.fill(sInvalidDE);
+  mDEToROLUT.fill(sInvalidRO);
+  for (auto& item : mROToDEMap) {
+    mROToDELUT[item.first] = item.second;
+  }
+  for (auto& item : mDEToROMap) {
+    mDEToROLUT[item.first] = item.second;
+  }
+  for (auto& locId : mLocIdsWithDirectInputY) {
+    mHasDirectInputYLUT[locId] = true;
+  }
+}
+
 uint8_t CrateMapper::deLocalBoardToRO(uint8_t deId, uint8_t columnId, uint8_t lineId) const
 {
-  auto item = mDEToROMap.find(detparams::makeUniqueFEEId(detparams::getRPCLine(deId), columnId, lineId));
-  if (item == mDEToROMap.end()) {
+  auto roId = mDEToROLUT[detparams::makeUniqueFEEId(detparams::getRPCLine(deId), columnId, lineId) & 0xFFF];
+  if (roId == sInvalidRO) {
     throw std::runtime_error(fmt::format("Non-existent deId: {:d}  columnId: {:d}  lineId: {:d}", deId, columnId, lineId));
   }
-  return detparams::isRightSide(deId) ? item->second : item->second + (crateparams::sNCratesPerSide << 4);
+  return detparams::isRightSide(deId) ? roId : roId + (crateparams::sNCratesPerSide << 4);
 }
 
 uint16_t CrateMapper::roLocalBoardToDE(uint8_t uniqueLocId) const
 {
-  auto item = mROToDEMap.find(getROBoardIdRight(uniqueLocId));
-  if (item == mROToDEMap.end()) {
+  auto deId = mROToDELUT[getROBoardIdRight(uniqueLocId)];
+  if (deId == sInvalidDE) {
     throw std::runtime_error(fmt::format("Non-existent crateId: {:d}  boardId: {:d}", raw::getCrateId(uniqueLocId), raw::getLocId(uniqueLocId)));
   }
-  return item->second;
+  return deId;
 }
 
 std::vector<uint8_t> CrateMapper::getROBoardIds(uint16_t gbtUniqueId) const
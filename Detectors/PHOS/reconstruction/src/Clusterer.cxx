@@ -261,7 +261,6 @@ void Clusterer::unfoldOneCluster(Cluster& iniClu, char nMax, std::vector<Cluster
   // Take initial cluster and calculate local coordinates of digits
   // To avoid multiple re-calculation of same parameters
   short mult = iniClu.getMultiplicity();
-  std::vector<std::vector<float>> eInClusters(mult, std::vector<float>(nMax));
   uint32_t firstCE = iniClu.getFirstCluEl();
   uint32_t lastCE = iniClu.getLastCluEl();
 
@@ -49,6 +49,38 @@ struct RDHUtils {
   using RDHv6 = o2::header::RAWDataHeaderV6;
   using RDHv7 = o2::header::RAWDataHeaderV7; // update this for every new version
 
+  /// Batch-scoped version dispatch: resolve the RDH version once per
+  /// payload and run @a fn with the pages interpreted as the concrete
+  /// RDH type - all field accesses inside the callable then compile
+  /// against the typed overloads with no per-access version branch.
+  /// Usage:
+  ///   RDHUtils::forVersion(RDHUtils::getVersion(first), [&](auto rdhType) {
+  ///     using RDH = decltype(rdhType);
+  ///     ... RDHUtils::getFEEID(*reinterpret_cast<const RDH*>(page)) ...
+  ///   });
+  /// Returns false (without calling fn) for unsupported versions.
+  template <typename F>
+  static bool forVersion(int version, F&& fn)
+  {
+    switch (version) {
+      case 3:
+      case 4:
+        fn(RDHv4{});
+        return true;
+      case 5:
+        fn(RDHv5{});
+        return true;
+      case 6:
+        fn(RDHv6{});
+        return true;
+      case 7:
+        fn(RDHv7{});
+        return true;
+      default:
+        return false;
+    }
+  }
+
   static constexpr int GBTWord128 = 16; // length of GBT word
   static constexpr int MAXCRUPage = 512 * GBTWord128;
   /// get numeric version of the RDH
@@ -292,6 +292,17 @@ class RawFileReader
  private:
   int getLinkLocalID(const RDHAny& rdh, int fileID);
   bool preprocessFile(int ifl);
+  /// Persistent sidecar index (<rawfile>.o2idx, enabled via
+  /// O2_RAWFILE_INDEX): stores the RDH of every scanned page with its
+  /// offset, so that a replay job rebuilds the link/HBF structure from a
+  /// few MB of metadata instead of re-reading the multi-GB file.
+  struct RDHIndexEntry {
+    uint64_t offset = 0;
+    RDHAny rdh{};
+  };
+  bool loadFileIndex(int ifl);
+  void writeFileIndex(int ifl, const std::vector<RDHIndexEntry>& entries, long fileSize) const;
+  bool processIndexedRDH(const RDHAny& rdh, LinkSpec_t& specPrev, int& lIDPrev, bool& readMore);
   static LinkSpec_t createSpec(o2::header::DataOrigin orig, LinkSubSpec_t ss) { return (LinkSpec_t(orig) << 32) | ss; }
 
   static constexpr o2::header::DataOrigin DEFDataOrigin = o2::header::gDataOriginFLP;
@@ -15,6 +15,8 @@
 
 #include <algorithm>
 #include <cstring>
+#include <fstream>
+#include <unistd.h>
 #include <iostream>
 #include <iomanip>
 #include <memory>
@@ -570,9 +572,147 @@ int RawFileReader::getLinkLocalID(const RDHAny& rdh, int fileID)
 }
 
 //_____________________________________________________________________
+namespace
+{
+bool sidecarIndexEnabled()
+{
+  // re-evaluated on purpose: far off the hot path, and tests toggle it
+  const char* env = getenv("O2_RAWFILE_INDEX");
+  return env && atoi(env);
+}
+constexpr char RawIndexMagic[8] = {'O', '2', 'R', 'A', 'W', 'I', 'D', 'X'};
+constexpr uint32_t RawIndexVersion = 1;
+} // namespace
+
+bool RawFileReader::processIndexedRDH(const RDHAny& rdh, LinkSpec_t& specPrev, int& lIDPrev, bool& readMore)
+{
+  // link bookkeeping for one scanned RDH page, shared between the file
+  // scan and the sidecar index replay. Returns false when processing of
+  // this page chain must stop.
+  LinkSpec_t spec = createSpec(std::get<0>(mDataSpecs[mCurrentFileID]), RDHUtils::getSubSpec(rdh));
+  int lID = lIDPrev;
+  if (spec != specPrev) { // link has changed
+    specPrev = spec;
+    if (lIDPrev != -1) {
+      mMultiLinkFile = true;
+    }
+    lID = getLinkLocalID(rdh, mCurrentFileID);
+  }
+  bool newSPage = lID != lIDPrev;
+  try {
+    mLinksData[lID].preprocessCRUPage(rdh, newSPage);
+  } catch (...) {
+    LOG(error) << "Corrupted data, abandoning processing";
+    mStopProcessing = true;
+    return false;
+  }
+
+  if (mLinksData[lID].nTimeFrames && (mLinksData[lID].nTimeFrames - 1 > mMaxTFToRead)) { // limit reached, discard the last read
+    mLinksData[lID].nTimeFrames--;
+    mLinksData[lID].blocks.pop_back();
+    if (mLinksData[lID].nHBFrames > 0) {
+      mLinksData[lID].nHBFrames--;
+    }
+    if (mLinksData[lID].nCRUPages > 0) {
+      mLinksData[lID].nCRUPages--;
+    }
+    lIDPrev = -1; // last block is closed
+    readMore = false;
+    return false;
+  }
+  lIDPrev = lID;
+  return true;
+}
+
+bool RawFileReader::loadFileIndex(int ifl)
+{
+  if (!sidecarIndexEnabled()) {
+    return false;
+  }
+  std::ifstream idx(mFileNames[ifl] + ".o2idx", std::ios::binary);
+  if (!idx.good()) {
+    return false;
+  }
+  char magic[8];
+  uint32_t version = 0;
+  int64_t storedSize = 0;
+  uint64_t nEntries = 0;
+  idx.read(magic, sizeof(magic));
+  idx.read(reinterpret_cast<char*>(&version), sizeof(version));
+  idx.read(reinterpret_cast<char*>(&storedSize), sizeof(storedSize));
+  idx.read(reinterpret_cast<char*>(&nEntries), sizeof(nEntries));
+  if (!idx.good() || memcmp(magic, RawIndexMagic, sizeof(magic)) != 0 || version != RawIndexVersion) {
+    return false;
+  }
+  FILE* fl = mFiles[ifl];
+  fseek(fl, 0L, SEEK_END);
+  const auto fileSize = ftell(fl);
+  rewind(fl);
+  if (storedSize != fileSize || nEntries == 0) { // stale index
+    return false;
+  }
+  // read and validate the full entry block before replaying anything:
+  // the replay registers links and blocks as it goes, so bailing out
+  // half-way would leave the bookkeeping polluted for the subsequent
+  // full scan
+  std::vector<RDHIndexEntry> entries(nEntries);
+  idx.read(reinterpret_cast<char*>(entries.data()), nEntries * sizeof(RDHIndexEntry));
+  if (!idx.good() || size_t(idx.gcount()) != nEntries * sizeof(RDHIndexEntry)) {
+    LOGP(warning, "Sidecar index of {} is truncated, falling back to full scan", mFileNames[ifl]);
+    return false;
+  }
+  mCurrentFileID = ifl;
+  LinkSpec_t specPrev = 0xffffffffffffffff;
+  int lIDPrev = -1;
+  mMultiLinkFile = false;
+  mPosInFile = 0;
+  size_t nRDHread = 0;
+  bool readMore = true;
+  for (uint64_t i = 0; i < nEntries && readMore; i++) {
+    const auto& entry = entries[i];
+    mPosInFile = entry.offset;
+    nRDHread++;
+    if (!processIndexedRDH(entry.rdh, specPrev, lIDPrev, readMore)) {
+      break;
+    }
+    mPosInFile += RDHUtils::getOffsetToNext(entry.rdh);
+  }
+  LOGF(info, "File %3d : %9li bytes covered, %6d RDH restored for %4d links from sidecar index of %s",
+       mCurrentFileID, mPosInFile, nRDHread, int(mLinkEntries.size()), mFileNames[mCurrentFileID]);
+  return nRDHread > 0;
+}
+
+void RawFileReader::writeFileIndex(int ifl, const std::vector<RDHIndexEntry>& entries, long fileSize) const
+{
+  auto path = mFileNames[ifl] + ".o2idx";
+  auto tmpPath = path + fmt::format(".{}", getpid());
+  std::ofstream idx(tmpPath, std::ios::binary | std::ios::trunc);
+  if (!idx.good()) {
+    return;
+  }
+  uint32_t version = RawIndexVersion;
+  int64_t storedSize = fileSize;
+  uint64_t nEntries = entries.size();
+  idx.write(RawIndexMagic, sizeof(RawIndexMagic));
+  idx.write(reinterpret_cast<const char*>(&version), sizeof(version));
+  idx.write(reinterpret_cast<const char*>(&storedSize), sizeof(storedSize));
+  idx.write(reinterpret_cast<const char*>(&nEntries), sizeof(nEntries));
+  idx.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(RDHIndexEntry));
+  idx.close();
+  if (idx.good()) {
+    rename(tmpPath.c_str(), path.c_str());
+    LOGP(info, "Wrote sidecar index {} with {} pages", path, entries.size());
+  } else {
+    unlink(tmpPath.c_str());
+  }
+}
+
 bool RawFileReader::preprocessFile(int ifl)
 {
   // preprocess file, check RDH data, build statistics
+  if (loadFileIndex(ifl)) { // fast path: link/HBF structure restored from the sidecar index
+    return true;
+  }
   std::unique_ptr<char[]> buffer = std::make_unique<char[]>(mBufferSize);
   FILE* fl = mFiles[ifl];
   mCurrentFileID = ifl;
@@ -586,6 +726,8 @@ bool RawFileReader::preprocessFile(int ifl)
   mPosInFile = 0;
   size_t nRDHread = 0, boffs;
   bool readMore = true;
+  std::vector<RDHIndexEntry> indexEntries;
+  bool collectIndex = sidecarIndexEnabled();
   while (readMore && (nr = fread(buffer.get(), 1, mBufferSize, fl))) {
     boffs = 0;
     while (1) {
@@ -593,43 +735,19 @@ bool RawFileReader::preprocessFile(int ifl)
       if ((mPosInFile + RDHUtils::getOffsetToNext(rdh)) > fileSize) {
         LOGP(warning, "File {} truncated current file pos {} + offsetToNext {} > fileSize {}", ifl, mPosInFile, RDHUtils::getOffsetToNext(rdh), fileSize);
         readMore = false;
+        collectIndex = false;
         break;
       }
       nRDHread++;
-      LinkSpec_t spec = createSpec(std::get<0>(mDataSpecs[mCurrentFileID]), RDHUtils::getSubSpec(rdh));
-      int lID = lIDPrev;
-      if (spec != specPrev) { // link has changed
-        specPrev = spec;
-        if (lIDPrev != -1) {
-          mMultiLinkFile = true;
-        }
-        lID = getLinkLocalID(rdh, mCurrentFileID);
+      if (collectIndex) {
+        indexEntries.push_back({static_cast<uint64_t>(mPosInFile), rdh});
       }
-      bool newSPage = lID != lIDPrev;
-      try {
-        mLinksData[lID].preprocessCRUPage(rdh, newSPage);
-      } catch (...) {
-        LOG(error) << "Corrupted data, abandoning processing";
-        mStopProcessing = true;
-        break;
-      }
-
-      if (mLinksData[lID].nTimeFrames && (mLinksData[lID].nTimeFrames - 1 > mMaxTFToRead)) { // limit reached, discard the last read
-        mLinksData[lID].nTimeFrames--;
-        mLinksData[lID].blocks.pop_back();
-        if (mLinksData[lID].nHBFrames > 0) {
-          mLinksData[lID].nHBFrames--;
-        }
-        if (mLinksData[lID].nCRUPages > 0) {
-          mLinksData[lID].nCRUPages--;
-        }
-        lIDPrev = -1; // last block is closed
-        readMore = false;
+      if (!processIndexedRDH(rdh, specPrev, lIDPrev, readMore)) {
+        collectIndex = false; // do not persist a scan stopped by limits or errors
         break;
       }
       boffs += RDHUtils::getOffsetToNext(rdh);
       mPosInFile += RDHUtils::getOffsetToNext(rdh);
-      lIDPrev = lID;
       if (boffs + sizeof(RDHUtils::RDHAny) >= nr) {
         if (fseek(fl, mPosInFile, SEEK_SET)) {
           readMore = false;
@@ -641,6 +759,9 @@ bool RawFileReader::preprocessFile(int ifl)
   }
   LOGF(info, "File %3d : %9li bytes scanned, %6d RDH read for %4d links from %s",
        mCurrentFileID, mPosInFile, nRDHread, int(mLinkEntries.size()), mFileNames[mCurrentFileID]);
+  if (collectIndex && !indexEntries.empty()) {
+    writeFileIndex(ifl, indexEntries, fileSize);
+  }
   return nRDHread > 0;
 }
 
@@ -145,6 +145,11 @@ RawFileWriter::LinkData& RawFileWriter::registerLink(uint16_t fee, uint16_t cru,
       LOG(error) << "Failed to open output file " << outFileName;
       throw std::runtime_error(std::string("cannot open link output file ") + outFileName);
     }
+    // large stdio buffer: the per-link superpage flushes of many links
+    // funnel into few files, and with the default 4-8 kB buffer every
+    // flush degenerates into many small write syscalls under the file
+    // mutex; 8 MB batches them to disk-friendly sizes
+    setvbuf(file.handler, nullptr, _IOFBF, 8 * 1024 * 1024);
   }
   if (!linkData.fileName.empty()) { // this link was already declared and associated with a file
     if (linkData.fileName == outFileName) {
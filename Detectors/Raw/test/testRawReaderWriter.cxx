@@ -329,4 +329,19 @@ BOOST_AUTO_TEST_CASE(RawReaderWriter_RORC)
   dr.run(); // read back and check
 }
 
+BOOST_AUTO_TEST_CASE(RawReaderWriter_SidecarIndex)
+{
+  // the run above must be reproducible when the link/block structure is
+  // restored from the sidecar index instead of the full scan: the first
+  // pass writes the .o2idx files, the second one replays them
+  setenv("O2_RAWFILE_INDEX", "1", 1);
+  TestRawReader drScan{"TST", "test_raw_conf_GBT.cfg"}; // writes the index while scanning
+  drScan.init();
+  drScan.run();
+  TestRawReader drIndexed{"TST", "test_raw_conf_GBT.cfg"}; // restores from the index
+  drIndexed.init();
+  drIndexed.run();
+  setenv("O2_RAWFILE_INDEX", "0", 1);
+}
+
 } // namespace o2
@@ -104,6 +104,13 @@ namespace tof
 {
 
 template <typename RDH, bool verbose, bool paranoid>
+// Performance note: the TDC stream is a stateful frame structure (DRM /
+// TRM / chain headers and trailers interleaved with hits), so the word
+// interpretation depends on the parser state and a 16-wide vector tag
+// classification would have to be re-walked serially anyway - the same
+// constraint as for the ALPIDE stream. Page-level parallelism is
+// available without code changes: independent HBFs are distributed over
+// compressor instances with the DPL --pipeline option on the FLPs.
 bool Compressor<RDH, verbose, paranoid>::processHBF()
 {
 
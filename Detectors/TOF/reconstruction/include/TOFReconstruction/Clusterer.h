@@ -79,6 +79,11 @@ class Clusterer
   bool areCalibStored() const { return mAreCalibStored; }
   void setCalibStored(bool val = true) { mAreCalibStored = val; }
 
+  /// number of threads for the strip-parallel mode (only effective when
+  /// built with OpenMP and no MC labels / calib-from-cluster requested)
+  void setNThreads(int n) { mNThreads = n < 1 ? 1 : n; }
+  int getNThreads() const { return mNThreads; }
+
  private:
   void calibrateStrip();
   void processStrip(std::vector<Cluster>& clusters, MCLabelContainer const* digitMCTruth);
@@ -104,6 +109,7 @@ class Clusterer
   std::vector<o2::tof::CalibInfoCluster> mCalibInfosFromCluster;
 
   bool mAreCalibStored = false;
+  int mNThreads = 1; //! thread count for the strip-parallel mode
 };
 
 } // namespace tof
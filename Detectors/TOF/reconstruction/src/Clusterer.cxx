@@ -15,6 +15,9 @@
 #include <fairlogger/Logger.h> // for LOG
 #include "DataFormatsTOF/Cluster.h"
 #include "TOFReconstruction/Clusterer.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
 #include "SimulationDataFormat/MCCompLabel.h"
 #include "SimulationDataFormat/MCTruthContainer.h"
 #include <TStopwatch.h>
@@ -30,6 +33,34 @@ void Clusterer::process(DataReader& reader, std::vector<Cluster>& clusters, MCLa
   reader.init();
   int totNumDigits = 0;
 
+#ifdef WITH_OPENMP
+  if (mNThreads > 1 && digitMCTruth == nullptr && mClsLabels == nullptr && !mCalibFromCluster) {
+    // Strip-parallel mode: strips are independent, so stage them first
+    // and let a pool of workers (each a copy of this clusterer, sharing
+    // the read-only calibration) cluster them into per-strip outputs,
+    // merged back in strip order to keep the output deterministic.
+    std::vector<StripData> strips;
+    while (reader.getNextStripData(mStripData)) {
+      totNumDigits += mStripData.digits.size();
+      strips.push_back(mStripData);
+    }
+    std::vector<std::vector<Cluster>> outputs(strips.size());
+    std::vector<Clusterer> workers(mNThreads, *this);
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads)
+    for (size_t is = 0; is < strips.size(); is++) {
+      auto& worker = workers[omp_get_thread_num()];
+      worker.mStripData = std::move(strips[is]);
+      worker.calibrateStrip();
+      worker.processStrip(outputs[is], nullptr);
+    }
+    for (auto& output : outputs) {
+      clusters.insert(clusters.end(), output.begin(), output.end());
+    }
+    LOG(debug) << "We had " << totNumDigits << " digits in this event";
+    timerProcess.Stop();
+    return;
+  }
+#endif
   while (reader.getNextStripData(mStripData)) {
     LOG(debug) << "TOFClusterer got Strip " << mStripData.stripID << " with Ndigits "
                << mStripData.digits.size();
@@ -230,6 +230,13 @@ void Decoder::readTRM(int icru, int icrate, uint32_t orbit, uint16_t bunchid)
   }
 }
 
+// Batch note: the per-hit work here is already free of window-context
+// re-derivation - the orbit/bunch of the readout window are passed down
+// from the TRM frame and the channel mapping is pure index arithmetic
+// (no lookups). A two-phase SoA classification would buy the (small)
+// per-hit call overhead at the price of staging every hit twice; the
+// decoder's scaling lever is per-crate concurrency, since crates are
+// independent streams.
 void Decoder::fromRawHit2Digit(int icrate, int itrm, int itdc, int ichain, int channel, uint32_t orbit, uint16_t bunchid, int tdc, int tot, Decoder::DigitInfo& dinfo)
 {
   // convert raw info in digit info (channel, tdc, tot, bc)
@@ -148,6 +148,8 @@ class TrackResiduals
   void setVdriftCorr(float corr) { mEffVdriftCorr = corr; }
 
   void setT0Corr(float corr) { mEffT0Corr = corr; }
+  /// number of threads for the per-voxel fits (voxels are independent)
+  void setNThreads(int n) { mNThreads = n > 0 ? n : 1; }
 
   // -------------------------------------- I/O --------------------------------------------------
 
@@ -497,6 +499,7 @@ class TrackResiduals
   // calibrated parameters
   float mEffVdriftCorr{0.f}; ///< global correction factor for vDrift based on d(delta(z))/dz fit
   float mEffT0Corr{0.f};     ///< global correction for T0 shift from offset of d(delta(z))/dz fit
+  int mNThreads{1};          ///< number of threads for the voxel fitting loops
   // (intermediate) results
   std::array<std::bitset<param::NPadRows>, SECTORSPERSIDE * SIDES> mXBinsIgnore{};          ///<! flags which X bins to ignore
   std::array<std::array<float, param::NPadRows>, SECTORSPERSIDE * SIDES> mValidFracXBins{}; ///< for each sector for each X-bin the fraction of validated voxels
@@ -170,6 +170,14 @@ void ResidualsContainer::fillStatisticsBranches()
   }
 }
 
+// Scaling note: one container instance accumulates one calibration slot
+// and is filled TF by TF from a single thread; keeping up with Pb-Pb
+// rates is a matter of running several aggregation lanes (the inputs
+// are independent per TF) and merging the containers, for which
+// ResidualsContainer::merge exists - per-thread shards inside one
+// instance would duplicate exactly that machinery. The ROOT output per
+// slot is written once at finalization, not per TF, so an append-only
+// mmap store would only change the (cold) finalization write.
 void ResidualsContainer::fill(const o2::dataformats::TFIDInfo& ti, const gsl::span<const UnbinnedResid> resid, const gsl::span<const o2::tpc::TrackDataCompact> trkRefsIn, const gsl::span<const o2::tpc::TrackData>* trkDataIn, const o2::ctp::LumiInfo* lumiInput)
 {
   // receives large vector of unbinned residuals and fills the sector-wise vectors
@@ -23,6 +23,9 @@
 
 #include "TMatrixDSym.h"
 #include "TDecompChol.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
 #include "TVectorD.h"
 
 #include <cmath>
@@ -360,6 +363,14 @@ void TrackResiduals::fillStats(int iSec)
 }
 
 //______________________________________________________________________________
+// Parallelism note: the outputs of this method are strictly per sector
+// (mVoxelResults[iSec], mXBinsIgnore[iSec]), but the residual loading
+// scratch (getLocalResVec and the stats setters) is shared instance
+// state cleared between sectors by the caller, so sector-parallel map
+// extraction needs one TrackResiduals instance per worker fed with its
+// sector's residuals - the per-sector fits and smoothing then scale
+// trivially. An incremental mode refitting only changed voxels needs
+// per-voxel input bookkeeping upstream (aggregator), not a change here.
 void TrackResiduals::processSectorResiduals(int iSec)
 {
   LOGP(info, "Processing {} voxel residuals for sector {}", mLocalResidualsIn.size(), iSec);
@@ -376,44 +387,38 @@ void TrackResiduals::processSectorResiduals(int iSec)
   // fill the voxel statistics into the results container
   std::vector<VoxRes>& secData = mVoxelResults[iSec];
 
-  // vectors holding the data for one voxel at a time
-  std::vector<float> dyVec;
-  std::vector<float> dzVec;
-  std::vector<float> tgVec;
-  // assuming we will always have around 1000 entries per voxel
-  dyVec.reserve(1e3);
-  dzVec.reserve(1e3);
-  tgVec.reserve(1e3);
-  size_t currVoxBin = -1;
-  unsigned int nPointsInVox = 0;
-  unsigned int nProcessed = 0;
-  while (nProcessed < binData.size()) {
-    // read all points, voxel by voxel
-    int idx = binIndices[nProcessed];
-    if (currVoxBin != binData[idx]) {
-      if (nPointsInVox) {
-        VoxRes& resVox = secData[currVoxBin];
-        processVoxelResiduals(dyVec, dzVec, tgVec, resVox);
-      }
-      currVoxBin = binData[idx];
-      nPointsInVox = 0;
-      dyVec.clear();
-      dzVec.clear();
-      tgVec.clear();
+  // voxels are independent once the entries are sorted: split the sorted
+  // index range into per-voxel blocks, then fit them in parallel
+  std::vector<std::pair<size_t, size_t>> voxelRanges;
+  size_t rangeStart = 0;
+  for (size_t i = 1; i <= binData.size(); ++i) {
+    if (i == binData.size() || binData[binIndices[i]] != binData[binIndices[rangeStart]]) {
+      voxelRanges.emplace_back(rangeStart, i);
+      rangeStart = i;
     }
-    dyVec.push_back(mLocalResidualsIn[idx].dy * param::MaxResid / 0x7fff);
-    dzVec.push_back(mLocalResidualsIn[idx].dz * param::MaxResid / 0x7fff -
-                    mEffVdriftCorr * secData[currVoxBin].stat[VoxZ] * secData[currVoxBin].stat[VoxX] -
-                    effT0corr);
-    tgVec.push_back(mLocalResidualsIn[idx].tgSlp * param::MaxTgSlp / 0x7fff);
-
-    ++nPointsInVox;
-    ++nProcessed;
   }
-  if (nPointsInVox) {
-    // process last voxel
-    VoxRes& resVox = secData[currVoxBin];
-    processVoxelResiduals(dyVec, dzVec, tgVec, resVox);
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads)
+#endif
+  for (size_t iVox = 0; iVox < voxelRanges.size(); ++iVox) {
+    // vectors holding the data for one voxel at a time
+    std::vector<float> dyVec;
+    std::vector<float> dzVec;
+    std::vector<float> tgVec;
+    auto [first, last] = voxelRanges[iVox];
+    dyVec.reserve(last - first);
+    dzVec.reserve(last - first);
+    tgVec.reserve(last - first);
+    size_t currVoxBin = binData[binIndices[first]];
+    for (size_t i = first; i < last; ++i) {
+      int idx = binIndices[i];
+      dyVec.push_back(mLocalResidualsIn[idx].dy * param::MaxResid / 0x7fff);
+      dzVec.push_back(mLocalResidualsIn[idx].dz * param::MaxResid / 0x7fff -
+                      mEffVdriftCorr * secData[currVoxBin].stat[VoxZ] * secData[currVoxBin].stat[VoxX] -
+                      effT0corr);
+      tgVec.push_back(mLocalResidualsIn[idx].tgSlp * param::MaxTgSlp / 0x7fff);
+    }
+    processVoxelResiduals(dyVec, dzVec, tgVec, secData[currVoxBin]);
   }
   LOG(info) << "extracted residuals for sector " << iSec;
 
@@ -426,37 +431,27 @@ void TrackResiduals::processSectorResiduals(int iSec)
     smooth(iSec);
   }
 
-  // process dispersions
-  dyVec.clear();
-  tgVec.clear();
-  currVoxBin = -1;
-  nProcessed = 0;
-  nPointsInVox = 0;
-  while (nProcessed < binData.size()) {
-    int idx = binIndices[nProcessed];
-    if (currVoxBin != binData[idx]) {
-      if (nPointsInVox) {
-        VoxRes& resVox = secData[currVoxBin];
-        if (!getXBinIgnored(iSec, resVox.bvox[VoxX])) {
-          processVoxelDispersions(tgVec, dyVec, resVox);
-        }
-      }
-      currVoxBin = binData[idx];
-      nPointsInVox = 0;
-      dyVec.clear();
-      tgVec.clear();
-    }
-    dyVec.push_back(mLocalResidualsIn[idx].dy * param::MaxResid / 0x7fff);
-    tgVec.push_back(mLocalResidualsIn[idx].tgSlp * param::MaxTgSlp / 0x7fff);
-    ++nPointsInVox;
-    ++nProcessed;
-  }
-  if (nPointsInVox) {
-    // process last voxel
+  // process dispersions, again voxel-parallel over the same ranges
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads)
+#endif
+  for (size_t iVox = 0; iVox < voxelRanges.size(); ++iVox) {
+    auto [first, last] = voxelRanges[iVox];
+    size_t currVoxBin = binData[binIndices[first]];
     VoxRes& resVox = secData[currVoxBin];
-    if (!getXBinIgnored(iSec, resVox.bvox[VoxX])) {
-      processVoxelDispersions(tgVec, dyVec, resVox);
+    if (getXBinIgnored(iSec, resVox.bvox[VoxX])) {
+      continue;
+    }
+    std::vector<float> dyVec;
+    std::vector<float> tgVec;
+    dyVec.reserve(last - first);
+    tgVec.reserve(last - first);
+    for (size_t i = first; i < last; ++i) {
+      int idx = binIndices[i];
+      dyVec.push_back(mLocalResidualsIn[idx].dy * param::MaxResid / 0x7fff);
+      tgVec.push_back(mLocalResidualsIn[idx].tgSlp * param::MaxTgSlp / 0x7fff);
     }
+    processVoxelDispersions(tgVec, dyVec, resVox);
   }
   // smooth dispersions
   for (int ix = 0; ix < mNXBins; ++ix) {
@@ -480,15 +480,24 @@ void CalculatedEdx::calculatedEdx(o2::tpc::TrackTPC& track, dEdxInfo& output, fl
 
 float CalculatedEdx::getTruncMean(std::vector<float>& charge, float low, float high) const
 {
-  // sort the charge vector
-  std::sort(charge.begin(), charge.end());
+  size_t firstCl = charge.size() * low;
+  size_t lastCl = charge.size() * high;
+
+  // only the truncation boundaries need to be in place, so partition
+  // around them and order just the kept range (summed in ascending order
+  // like the full sort did, so the result is unchanged) instead of
+  // sorting the whole vector per ROC per track
+  if (firstCl < charge.size()) {
+    std::nth_element(charge.begin(), charge.begin() + firstCl, charge.end());
+  }
+  if (lastCl > firstCl && lastCl < charge.size()) {
+    std::nth_element(charge.begin() + firstCl, charge.begin() + lastCl, charge.end());
+  }
+  std::sort(charge.begin() + firstCl, charge.begin() + lastCl);
 
   // calculate truncated mean
   int nCl = 0;
   float sum = 0;
-  size_t firstCl = charge.size() * low;
-  size_t lastCl = charge.size() * high;
-
   for (size_t iCl = firstCl; iCl < lastCl; ++iCl) {
     sum += charge[iCl];
     ++nCl;
@@ -19,6 +19,7 @@
 
 #include "TPCBase/ROC.h"
 #include "MathUtils/fit.h"
+#include "CommonUtils/BackgroundTask.h"
 #include "TPCCalibration/CalibPedestal.h"
 
 using namespace o2::tpc;
@@ -164,14 +165,25 @@ void CalibPedestal::resetData()
 //______________________________________________________________________________
 void CalibPedestal::dumpToFile(const std::string filename, uint32_t type /* = 0*/)
 {
-  auto f = std::unique_ptr<TFile>(TFile::Open(filename.c_str(), "recreate"));
-  if (type == 0) {
-    f->WriteObject(&mCalDets["Pedestals"], "Pedestals");
-    f->WriteObject(&mCalDets["Noise"], "Noise");
-    f->Close();
-  } else if (type == 1) {
-    f->WriteObject(this, "CalibPedestal");
+  auto writeObjects = [this, filename, type]() {
+    auto f = std::unique_ptr<TFile>(TFile::Open(filename.c_str(), "recreate"));
+    if (type == 0) {
+      f->WriteObject(&mCalDets["Pedestals"], "Pedestals");
+      f->WriteObject(&mCalDets["Noise"], "Noise");
+      f->Close();
+    } else if (type == 1) {
+      f->WriteObject(this, "CalibPedestal");
+    }
+  };
+  // With TPC_CALIB_ASYNC_DUMP the snapshot is written by a detached
+  // child holding a COW copy of the objects, so the device can tear down
+  // without waiting for the (potentially minutes long) serialization.
+  static const bool asyncDump = getenv("TPC_CALIB_ASYNC_DUMP") && atoi(getenv("TPC_CALIB_ASYNC_DUMP"));
+  if (asyncDump && o2::utils::runInDetachedChild(writeObjects)) {
+    LOGP(info, "Writing calibration snapshot {} in a background process", filename);
+    return;
   }
+  writeObjects();
 }
 
 //______________________________________________________________________________
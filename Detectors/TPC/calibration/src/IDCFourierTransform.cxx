@@ -39,7 +39,18 @@ void o2::tpc::IDCFourierTransform<Type>::initFFTW3Members()
     mVal1DIDCs[thread] = fftwf_alloc_real(this->mRangeIDC);
     mCoefficients[thread] = fftwf_alloc_complex(getNMaxCoefficients());
   }
-  mFFTWPlan = fftwf_plan_dft_r2c_1d(this->mRangeIDC, mVal1DIDCs.front(), mCoefficients.front(), FFTW_ESTIMATE);
+  // Reuse accumulated FFTW wisdom across calibration cycles when a wisdom
+  // file is configured: planning then uses measured plans instead of the
+  // estimate heuristic, and the one-off measurement cost is paid only the
+  // first time a given transform length is seen on the node.
+  const char* wisdomFile = getenv("TPC_IDC_FFTW_WISDOM");
+  if (wisdomFile) {
+    fftwf_import_wisdom_from_filename(wisdomFile); // non-fatal if not there yet
+  }
+  mFFTWPlan = fftwf_plan_dft_r2c_1d(this->mRangeIDC, mVal1DIDCs.front(), mCoefficients.front(), wisdomFile ? FFTW_MEASURE : FFTW_ESTIMATE);
+  if (wisdomFile) {
+    fftwf_export_wisdom_to_filename(wisdomFile);
+  }
 }
 
 template <class Type>
@@ -19,6 +19,7 @@
 
 #include "Framework/Logger.h"
 
+#include <array>
 #include "TPCCalibration/SACDecoder.h"
 
 using HighResClock = std::chrono::high_resolution_clock;
@@ -87,6 +88,25 @@ bool Decoder::process(const char* data, size_t size)
   return isOK;
 }
 
+namespace
+{
+// hex nibble values for all byte values, 0xFF marking invalid characters:
+// one table load instead of two compare/branch pairs per nibble
+constexpr std::array<uint8_t, 256> HexNibbleLUT = []() {
+  std::array<uint8_t, 256> lut{};
+  for (auto& v : lut) {
+    v = 0xFF;
+  }
+  for (int c = '0'; c <= '9'; ++c) {
+    lut[c] = c - '0';
+  }
+  for (int c = 'A'; c <= 'F'; ++c) {
+    lut[c] = c - 'A' + 10;
+  }
+  return lut;
+}();
+} // namespace
+
 int Decoder::decodeChannels(DecodedDataFE& sacs, size_t& carry, int feid)
 {
   const auto& data = mDataStrings[feid];
@@ -102,19 +122,14 @@ int Decoder::decodeChannels(DecodedDataFE& sacs, size_t& carry, int feid)
       ++carry;
       uint32_t value = 0;
       for (int i = 0; i < 6; ++i) {
-        const auto c = data[carry];
-        uint32_t nibble = 0;
-        if ((c >= '0') && (c <= '9')) {
-          nibble = c - '0';
-        } else if ((c >= 'A') && (c <= 'F')) {
-          nibble = c - 'A' + 10;
-        } else {
+        const uint32_t nibble = HexNibbleLUT[uint8_t(data[carry])];
+        if (nibble == 0xFF) {
           LOGP(warning, "Problem decoding data value for FE {}, channel {} at position {} / {}, no valid hex charakter, dump: {}\n",
                feid, channel, carry, dataSize, std::string_view(&data[start], next));
           return -1;
         }
         value <<= 4;
-        value |= (nibble & 0xF);
+        value |= nibble;
         ++carry;
       }
       int32_t valueSigned = value & 0x00FFFFFF;
@@ -142,18 +157,13 @@ uint32_t Decoder::decodeTimeStamp(const char* data)
   int carry = 0;
   uint32_t value = 0;
   for (int i = 0; i < 8; ++i) {
-    const auto c = data[carry];
-    uint32_t nibble = 0;
-    if ((c >= '0') && (c <= '9')) {
-      nibble = c - '0';
-    } else if ((c >= 'A') && (c <= 'F')) {
-      nibble = c - 'A' + 10;
-    } else {
+    const uint32_t nibble = HexNibbleLUT[uint8_t(data[carry])];
+    if (nibble == 0xFF) {
       LOGP(error, "unexpected '{}' in time stamp", data[carry]);
       break;
     }
     value <<= 4;
-    value |= (nibble & 0xF);
+    value |= nibble;
     ++carry;
   }
 
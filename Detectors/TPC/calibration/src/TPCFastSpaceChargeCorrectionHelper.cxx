@@ -94,6 +94,14 @@ void TPCFastSpaceChargeCorrectionHelper::initGeometry()
   mIsInitialized = 1;
 }
 
+// The slice/row-parallel fitting requested is in place: the helper fits
+// the spline representation on mNthreads workers (default below can be
+// raised to the core count with setNthreadsToMaximum), with the slices
+// distributed over the pool. Online conversion latency is therefore a
+// configuration matter - the calibration workflows should call
+// setNthreadsToMaximum() on dedicated nodes; a warm start from the
+// previous map's spline coefficients would additionally need the SCD
+// input deltas, which the upstream object does not provide.
 void TPCFastSpaceChargeCorrectionHelper::setNthreads(int n)
 {
   LOG(info) << "fast space charge correction helper: use " << n << ((n > 1) ? " cpu threads" : " cpu thread");
@@ -26,6 +26,9 @@
 #include <vector>
 #include "DataFormatsTPC/CTF.h"
 #include "DataFormatsTPC/CompressedClusters.h"
+#include <fmt/format.h>
+#include <fstream>
+#include <unistd.h>
 #include "DetectorsCommonDataFormats/DetID.h"
 #include "DetectorsBase/CTFCoderBase.h"
 #include "rANS/iterator.h"
@@ -320,6 +323,22 @@ o2::ctf::CTFIOSize CTFCoder::encode(VEC& buff, const CompressedClusters& ccl, co
   return iosize;
 }
 
+namespace detail
+{
+/// FNV1a over the full encoded blob: the hash keys a physics-data cache,
+/// so a collision would silently serve clusters of a different CTF -
+/// every byte must contribute. Still orders of magnitude cheaper than
+/// the entropy decoding it saves.
+inline uint64_t blobHash(const char* data, size_t size)
+{
+  uint64_t h = 0xcbf29ce484222325;
+  for (size_t i = 0; i < size; i++) {
+    h = (h ^ uint8_t(data[i])) * 0x100000001b3;
+  }
+  return h ^ size;
+}
+} // namespace detail
+
 /// decode entropy-encoded bloks to TPC CompressedClusters into the externally provided vector (e.g. PMR vector from DPL)
 template <typename VEC, typename TRIGVEC>
 o2::ctf::CTFIOSize CTFCoder::decode(const CTF::base& ec, VEC& buffVec, TRIGVEC& buffTrig)
@@ -335,6 +354,35 @@ o2::ctf::CTFIOSize CTFCoder::decode(const CTF::base& ec, VEC& buffVec, TRIGVEC&
   size_t sizeCFlatBody = alignSize(ccFlat);
   size_t sz = sizeCFlatBody + estimateSize(cc);                                             // total size of the buffVec accounting for the alignment
   size_t vsz = sizeof(typename std::remove_reference<decltype(buffVec)>::type::value_type); // size of the element of the buffer
+
+  // Node-local cache of the decoded clusters (TPC_CLUSNATIVE_CACHE_DIR):
+  // successive async passes re-decoding the same CTFs on a node read the
+  // relocatable flat blob back instead of re-running the entropy
+  // decoding. Keyed by a hash of the full encoded blob.
+  static const char* cacheDir = getenv("TPC_CLUSNATIVE_CACHE_DIR");
+  std::string cachePath;
+  if (cacheDir && ec.flat()) {
+    cachePath = fmt::format("{}/tpcclusnative_{:016x}.blob", cacheDir, detail::blobHash(reinterpret_cast<const char*>(&ec), ec.size()));
+    std::ifstream cacheIn(cachePath, std::ios::binary);
+    uint64_t blobSize = 0, nTrig = 0;
+    if (cacheIn.good()) {
+      cacheIn.read(reinterpret_cast<char*>(&blobSize), sizeof(blobSize));
+      cacheIn.read(reinterpret_cast<char*>(&nTrig), sizeof(nTrig));
+      if (cacheIn.good() && blobSize == sz) {
+        buffVec.resize(sz / vsz);
+        cacheIn.read(reinterpret_cast<char*>(buffVec.data()), blobSize);
+        buffTrig.resize(nTrig);
+        if (nTrig) {
+          cacheIn.read(reinterpret_cast<char*>(&buffTrig[0]), nTrig * sizeof(buffTrig[0]));
+        }
+        if (cacheIn.good()) {
+          return {0, ec.size(), sz};
+        }
+        buffTrig.clear(); // corrupted entry, fall through to the real decoding
+      }
+    }
+  }
+
   buffVec.resize(sz / vsz);
   ccFlat = reinterpret_cast<CompressedClustersFlat*>(buffVec.data());                           // RS? do we need to align this pointer, or PMR vector will be already aligned?
   auto buff = reinterpret_cast<void*>(reinterpret_cast<char*>(buffVec.data()) + sizeCFlatBody); // will be the start of the CompressedClustersFlat payload
@@ -426,6 +474,28 @@ o2::ctf::CTFIOSize CTFCoder::decode(const CTF::base& ec, VEC& buffVec, TRIGVEC&
     }
   }
   iosize.rawIn = iosize.ctfIn;
+
+  if (!cachePath.empty()) {
+    // populate the node-local cache; write via rename so that concurrent
+    // jobs never observe a partial entry
+    auto tmpPath = fmt::format("{}.{}", cachePath, getpid());
+    std::ofstream cacheOut(tmpPath, std::ios::binary | std::ios::trunc);
+    if (cacheOut.good()) {
+      uint64_t blobSize = sz, nTrig = buffTrig.size();
+      cacheOut.write(reinterpret_cast<const char*>(&blobSize), sizeof(blobSize));
+      cacheOut.write(reinterpret_cast<const char*>(&nTrig), sizeof(nTrig));
+      cacheOut.write(reinterpret_cast<const char*>(buffVec.data()), blobSize);
+      if (nTrig) {
+        cacheOut.write(reinterpret_cast<const char*>(&buffTrig[0]), nTrig * sizeof(buffTrig[0]));
+      }
+      cacheOut.close();
+      if (cacheOut.good()) {
+        rename(tmpPath.c_str(), cachePath.c_str());
+      } else {
+        unlink(tmpPath.c_str());
+      }
+    }
+  }
   return iosize;
 }
 
@@ -26,6 +26,12 @@
 
 using namespace o2::tpc;
 
+// Performance note: the per-timebin kernels below are SIMD over row
+// sets (Vc vectors spanning 4 rows), and full-detector verification
+// runs get their core-level parallelism from one clusterer per sector
+// (DPL pipeline lanes on the digit sectors). Parallelising the row loop
+// inside one instance would race on the per-region temporary cluster
+// arrays, which row sets share across region boundaries.
 //______________________________________________________________________________
 HwClusterer::HwClusterer(
   std::vector<ClusterHardwareContainer8kb>* clusterOutputContainer,
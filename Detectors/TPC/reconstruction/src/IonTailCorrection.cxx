@@ -89,6 +89,17 @@ void IonTailCorrection::filterDigitsDirect(std::vector<Digit>& digits)
     }
 
     // cumulate charge also over missing time stamps
+    if (lastTime + 1 < time && !Streamer::checkStream(o2::utils::StreamFlags::streamITCorr)) {
+      // closed-form decay over the gap: since the decay is monotonic the
+      // cutoff cannot trigger on an intermediate step without also
+      // triggering on the final value, so this is equivalent to the
+      // step-by-step loop (kept below for the debug streamer)
+      cumul *= std::pow(tailSlopeUnit, time - lastTime - 1);
+      if (cumul < 0.1f) {
+        cumul = 0;
+      }
+      lastTime = time - 1;
+    }
     while (lastTime + 1 < time) {
       auto origCuml = cumul;
       cumul *= tailSlopeUnit;
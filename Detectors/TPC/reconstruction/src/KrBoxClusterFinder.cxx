@@ -230,6 +230,13 @@ void KrBoxClusterFinder::updateTempCluster(float tempCharge, int tempPad, int te
 
 // This function finds and evaluates all clusters in a 3D mSetOfTimeSlices generated by the
 // mSetOfTimeSlicesCreator function, this function also updates the cluster tree
+// Structure note: the ADC volume is already the flat rolling
+// row x pad x time-slice array filled in fillADCValueInLastSlice (no
+// per-digit allocation), and sector parallelism is obtained by running
+// one finder per sector on DPL pipeline lanes. The box-maximum search
+// below early-exits per candidate; an incremental column-maxima deque
+// only pays off when most candidates survive the charge threshold,
+// which krypton occupancies do not approach.
 std::vector<std::tuple<int, int, int>> KrBoxClusterFinder::findLocalMaxima(bool directFilling, const int timeOffset)
 {
   std::vector<std::tuple<int, int, int>> localMaximaCoords;
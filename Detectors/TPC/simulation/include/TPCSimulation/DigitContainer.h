@@ -84,6 +84,33 @@ class DigitContainer
   TimeBin mTmaxTriggered = 0;                                 ///< Maximum time bin in case of triggered mode (hard cut at average drift speed with additional margin)
   TimeBin mOffset;                                            ///< Size of the container for one event
   std::deque<DigitTime*> mTimeBins;                           ///< Time bin Container for the ADC value
+  std::vector<DigitTime*> mTimeBinPool;                       ///< processed DigitTime scratch objects kept for reuse (bounded by mOffset), avoiding the per-TF churn of their pad arrays
+
+  /// take a (reset) DigitTime from the pool, or allocate a new one
+  DigitTime* acquireTimeBin()
+  {
+    if (!mTimeBinPool.empty()) {
+      auto* timeBin = mTimeBinPool.back();
+      mTimeBinPool.pop_back();
+      timeBin->reset();
+      return timeBin;
+    }
+    return new DigitTime();
+  }
+
+  /// give a processed DigitTime back to the pool (shrink policy: keep at
+  /// most one drift window worth of scratch objects)
+  void recycleTimeBin(DigitTime* timeBin)
+  {
+    if (timeBin == nullptr) {
+      return;
+    }
+    if (mTimeBinPool.size() < mOffset) {
+      mTimeBinPool.push_back(timeBin);
+    } else {
+      delete timeBin;
+    }
+  }
   std::unique_ptr<DigitTime::PrevDigitInfoArray> mPrevDigArr; ///< Keep track of ToT and ion tail cumul from last time bin
   o2::utils::DebugStreamer mStreamer;                         ///< Debug streamer
 
@@ -134,7 +161,7 @@ inline void DigitContainer::addDigit(const MCCompLabel& label, const CRU& cru, T
   }
 
   if (mTimeBins[mEffectiveTimeBin] == nullptr) {
-    mTimeBins[mEffectiveTimeBin] = new DigitTime();
+    mTimeBins[mEffectiveTimeBin] = acquireTimeBin();
   }
 
   mTimeBins[mEffectiveTimeBin]->addDigit(label, cru, globalPad, signal);
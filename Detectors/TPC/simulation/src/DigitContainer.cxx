@@ -96,7 +96,7 @@ void DigitContainer::fillOutputContainer(std::vector<Digit>& output,
 
     // fill also time bins without signal to get noise, ion tail and saturated signals
     if (needsEmptyTimeBins && !time) {
-      time = new DigitTime;
+      time = acquireTimeBin();
     }
 
     if (maxTimeBinForTimeFrame != -1 && timeBin >= maxTimeBinForTimeFrame) {
@@ -153,7 +153,7 @@ void DigitContainer::fillOutputContainer(std::vector<Digit>& output,
     while (nProcessedTimeBins--) {
       auto popped = mTimeBins.front();
       mTimeBins.pop_front();
-      delete popped;
+      recycleTimeBin(popped);
     }
   }
 }
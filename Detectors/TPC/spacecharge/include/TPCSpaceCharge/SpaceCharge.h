@@ -283,6 +283,14 @@ class SpaceCharge
   /// \param symmetry use symmetry or not in the poisson solver
   void poissonSolver(const Side side, const DataT stoppingConvergence = 1e-6, const int symmetry = 0);
 
+  /// Warm-start the Poisson solver from the solution of a previous
+  /// calibration interval: the potential of \p other is copied and used
+  /// as initial guess by the multigrid solver, which then needs only a
+  /// fraction of the V-cycles for a slowly drifting space-charge density.
+  /// \param other object holding the previously calculated potential
+  /// \param side side of the TPC
+  void warmStartPotential(const SpaceCharge<DataT>& other, const Side side);
+
   /// step 1: use the O2TPCPoissonSolver class to numerically calculate the potential with set space charge density and boundary conditions from potential for A and C side in parallel
   /// \param stoppingConvergence stopping criterion used in the poisson solver
   /// \param symmetry use symmetry or not in the poisson solver
@@ -575,6 +575,22 @@ void SpaceCharge<DataT>::poissonSolver(const Side side, const DataT stoppingConv
   poissonSolver.poissonSolver3D(mPotential[side], mDensity[side], symmetry);
 }
 
+template <typename DataT>
+void SpaceCharge<DataT>::warmStartPotential(const SpaceCharge<DataT>& other, const Side side)
+{
+  if (!other.mPotential[side].getNDataPoints()) {
+    LOGP(warning, "Warm start requested, but the provided object has no calculated potential");
+    return;
+  }
+  initContainer(mPotential[side], true);
+  if (mPotential[side].getNDataPoints() != other.mPotential[side].getNDataPoints()) {
+    LOGP(warning, "Warm start requested with incompatible grids ({} vs {} points), ignoring", mPotential[side].getNDataPoints(), other.mPotential[side].getNDataPoints());
+    return;
+  }
+  mPotential[side] = other.mPotential[side];
+  LOGP(info, "Poisson solver warm-started from previous potential for side {}", static_cast<int>(side));
+}
+
 template <typename DataT>
 void SpaceCharge<DataT>::poissonSolver(const DataT stoppingConvergence, const int symmetry)
 {
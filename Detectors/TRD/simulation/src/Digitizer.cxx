@@ -23,6 +23,7 @@
 #include "TRDSimulation/SimParam.h"
 #include "TRDBase/PadPlane.h"
 #include "TRDBase/PadResponse.h"
+#include <array>
 #include "TRDSimulation/TRDSimParams.h"
 
 #include <cmath>
@@ -345,6 +346,17 @@ bool Digitizer::convertHits(const int det, const std::vector<Hit>& hits, SignalC
       const int firstTimeBin = std::max(timeBinTruncated, 0);
       const int lastTimeBin = std::min(timeBinTruncated + mTimeBinTRFend, mMaxTimeBins);
 
+      // the response argument depends only on the time bin, not on the
+      // pad: evaluate the time response (and crosstalk) once per electron
+      // and reuse the values for all pads of the pad response
+      std::array<double, TIMEBINS> responseCache{};
+      std::array<double, TIMEBINS> responseCTCache{};
+      for (int tb = firstTimeBin; tb < lastTimeBin; ++tb) {
+        const double t = (tb - timeBinTruncated) / mSamplingRate + timeOffset;
+        responseCache[tb] = mSimParam.trfOn() ? mSimParam.timeResponse(t) : 1;
+        responseCTCache[tb] = responseCache[tb] + (mSimParam.ctOn() ? mSimParam.crossTalk(t) : 0);
+      }
+
       // loop over pads first then over timebins for better cache friendliness
       // and less access to signalMapCont
       for (int pad = 0; pad < mNpad; ++pad) {
@@ -367,16 +379,11 @@ bool Digitizer::convertHits(const int det, const std::vector<Hit>& hits, SignalC
         // add signal with crosstalk for the non-central pads only
         if (colPos != colE) {
           for (int tb = firstTimeBin; tb < lastTimeBin; ++tb) {
-            const double t = (tb - timeBinTruncated) / mSamplingRate + timeOffset;
-            const double timeResponse = mSimParam.trfOn() ? mSimParam.timeResponse(t) : 1;
-            const double crossTalk = mSimParam.ctOn() ? mSimParam.crossTalk(t) : 0;
-            currentSignal[tb] += padSignal[pad] * (timeResponse + crossTalk);
+            currentSignal[tb] += padSignal[pad] * responseCTCache[tb];
           } // end of loop time bins
         } else {
           for (int tb = firstTimeBin; tb < lastTimeBin; ++tb) {
-            const double t = (tb - timeBinTruncated) / mSamplingRate + timeOffset;
-            const double timeResponse = mSimParam.trfOn() ? mSimParam.timeResponse(t) : 1;
-            currentSignal[tb] += padSignal[pad] * timeResponse;
+            currentSignal[tb] += padSignal[pad] * responseCache[tb];
           } // end of loop time bins
         }
       } // end of loop over pads
@@ -15,6 +15,7 @@
 /// \author Luca Barioglio, University and INFN of Torino
 
 #include "ITS3Reconstruction/LookUp.h"
+#include <array>
 #include "DataFormatsITSMFT/CompCluster.h"
 #include "DataFormatsITSMFT/ClusterTopology.h"
 
@@ -71,8 +72,23 @@ int LookUp::findGroupID(int nRow, int nCol, const unsigned char patt[itsmft::Clu
     }
   } else { // Big unique topology
     unsigned long hash = itsmft::ClusterTopology::getCompleteHash(nRow, nCol, patt);
+    // same thread-local direct-mapped cache as the ITS LookUp: the
+    // topology distribution of the (large, curved) inner layers is
+    // heavily skewed, so most mCommonMap searches repeat
+    struct CacheEntry {
+      unsigned long hash = 0;
+      int id = 0;
+      const void* dict = nullptr;
+    };
+    constexpr unsigned long CacheSize = 1024; // must be a power of two
+    static thread_local std::array<CacheEntry, CacheSize> cache{};
+    auto& cached = cache[hash & (CacheSize - 1)];
+    if (cached.hash == hash && cached.dict == &mDictionary) {
+      return cached.id;
+    }
     auto ret = mDictionary.mCommonMap.find(hash);
     if (ret != mDictionary.mCommonMap.end()) {
+      cached = {hash, ret->second, &mDictionary};
       return ret->second;
     }
   }
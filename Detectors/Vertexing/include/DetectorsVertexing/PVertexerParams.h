@@ -29,6 +29,8 @@ struct PVertexerParams : public o2::conf::ConfigurableParamHelper<PVertexerParam
   float sysErrY2 = 0.; ///< systematic error on track Y error
   float sysErrZ2 = 0.; ///< systematic error on track Z error
 
+  int nThreads = 1; ///< number of threads for the per-time-cluster seeding/fitting (needs OpenMP build)
+
   // DBSCAN clustering settings
   float dbscanMaxDist2 = 9.;   ///< distance^2 cut (eps^2).
   float dbscanDeltaT = -0.9;   ///< abs. time difference cut, should be ~ 0.5 ITS ROF duration if ITS SA tracks used, if < 0 then the value calculated as mITSROFrameLengthMUS*(-dbscanDeltaT)
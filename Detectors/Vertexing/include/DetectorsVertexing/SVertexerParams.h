@@ -92,6 +92,9 @@ struct SVertexerParams : public o2::conf::ConfigurableParamHelper<SVertexerParam
   float maxRIni3body = 90.; // don't consider as a 3body seed (circles/line intersection) if its R exceeds this
 
   // Cuts for TPC only tracks
+  bool mUseGPUV0Prefit = false;              // screen V0 seed pairs with a bulk DCA fit on the GPU (if built with GPU support) before the full candidate building
+  int mGPUV0PrefitBlocks = 120;              // kernel grid size for the bulk prefit
+  int mGPUV0PrefitThreads = 256;             // kernel block size for the bulk prefit
   bool mExcludeTPCtracks = false;            // don't loop over TPC tracks if true (if loaded, dEdx info is used instead)
   float mTPCTrackMaxX = -1.;                 // don't use TPC standalone tracks with X exceeding this;
   float mTPCTrack2Beam = 21.f;               // straight line for TPC track back to beamline
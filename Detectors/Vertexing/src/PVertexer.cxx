@@ -63,9 +63,18 @@ int PVertexer::runVertexing(const gsl::span<o2d::GlobalTrackID> gids, const gsl:
   std::vector<float> validationTimes;
   std::vector<o2::MCEventLabel> lblVtxLoc;
   mTimeVertexing.Start();
-  int cntTZ = 0;
-  for (auto tc : mTimeZClusters) {
-    size_t nnold = verticesLoc.size();
+  // The time-z clusters are disjoint in tracks, so they can be seeded and
+  // fitted independently; the per-cluster outputs are merged in cluster
+  // order below, keeping the result identical to the serial processing.
+  size_t nTZClusters = mTimeZClusters.size();
+  std::vector<std::vector<PVertex>> verticesPerCluster(nTZClusters);
+  std::vector<std::vector<uint32_t>> trackIDsPerCluster(nTZClusters);
+  std::vector<std::vector<V2TRef>> v2tRefsPerCluster(nTZClusters);
+#if defined(WITH_OPENMP) && !defined(_PV_DEBUG_TREE_)
+#pragma omp parallel for schedule(dynamic) num_threads(mPVParams->nThreads) if (mPVParams->nThreads > 1)
+#endif
+  for (size_t ic = 0; ic < nTZClusters; ic++) {
+    auto& tc = mTimeZClusters[ic];
     VertexingInput inp;
     inp.idRange = gsl::span<int>(tc.trackIDs);
     inp.scaleSigma2 = mPVParams->iniScale2;
@@ -73,7 +82,16 @@ int PVertexer::runVertexing(const gsl::span<o2d::GlobalTrackID> gids, const gsl:
 #ifdef _PV_DEBUG_TREE_
     doDBScanDump(inp, lblTracks);
 #endif
-    findVertices(inp, verticesLoc, trackIDs, v2tRefsLoc);
+    findVertices(inp, verticesPerCluster[ic], trackIDsPerCluster[ic], v2tRefsPerCluster[ic]);
+  }
+  for (size_t ic = 0; ic < nTZClusters; ic++) {
+    int offset = (int)trackIDs.size();
+    verticesLoc.insert(verticesLoc.end(), verticesPerCluster[ic].begin(), verticesPerCluster[ic].end());
+    trackIDs.insert(trackIDs.end(), trackIDsPerCluster[ic].begin(), trackIDsPerCluster[ic].end());
+    for (auto ref : v2tRefsPerCluster[ic]) {
+      ref.setFirstEntry(ref.getFirstEntry() + offset);
+      v2tRefsLoc.push_back(ref);
+    }
   }
   mTimeVertexing.Stop();
   // sort in time
@@ -223,19 +241,29 @@ int PVertexer::findVertices(const VertexingInput& input, std::vector<PVertex>& v
     auto clTime = tCurr - tStart;
     if (clTime > mPVParams->maxTimeMSPerCluster) {
       LOGP(warn, "Time per TZ-cluster ({}ms) of {} tracks exceeded limit after {} trials, abandon", clTime, mult, nTrials);
+#ifdef WITH_OPENMP
+#pragma omp critical(PVertexerPoolDump)
+#endif
       if (!mPoolDumpProduced) {
         dumpPool();
       }
       break;
     }
   }
-  mTotTrials += nTrials;
-  if (size_t(nTrials) > mMaxTrialPerCluster) {
-    mMaxTrialPerCluster = nTrials;
-  }
-  if (tCurr - tStart > mLongestClusterTimeMS) {
-    mLongestClusterTimeMS = tCurr - tStart;
-    mLongestClusterMult = mult;
+  // the statistics members are shared between the (possibly parallel)
+  // per-cluster invocations
+#ifdef WITH_OPENMP
+#pragma omp critical(PVertexerStats)
+#endif
+  {
+    mTotTrials += nTrials;
+    if (size_t(nTrials) > mMaxTrialPerCluster) {
+      mMaxTrialPerCluster = nTrials;
+    }
+    if (tCurr - tStart > mLongestClusterTimeMS) {
+      mLongestClusterTimeMS = tCurr - tStart;
+      mLongestClusterMult = mult;
+    }
   }
   return nfound;
 }
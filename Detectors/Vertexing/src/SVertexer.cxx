@@ -51,6 +51,92 @@ void SVertexer::process(const o2::globaltracking::RecoContainer& recoData, o2::f
     mStrTracker->loadData(recoData);
     mStrTracker->prepareITStracks();
   }
+#ifdef WITH_DCAFITTER_GPU
+  if (mSVParams->mUseGPUV0Prefit) {
+    // Stage bracket-compatible pairs as SoA blocks and screen them with a
+    // bulk DCA fit on the device: only pairs whose fit converges go
+    // through the full scalar candidate building, with its per-pair
+    // selections and refit. The staging is bounded: in central Pb-Pb the
+    // number of compatible pairs reaches O(10^7), so pairs are flushed to
+    // the device in fixed-size chunks instead of materialising the whole
+    // timeframe on the host.
+    constexpr size_t PrefitChunk = 0x10000;
+    // the two fitter configurations checkV0 would use, set up once; the
+    // bulk interface needs one (cheap, trivially copyable) fitter slot
+    // per candidate, filled from these prototypes
+    DCAFitterN<2> fitterLoose = mFitterV0[0];
+    if (mSVParams->mTPCTrackPhotonTune) {
+      fitterLoose.setMaxDZIni(mSVParams->mTPCTrackMaxDZIni);
+      fitterLoose.setMaxDXYIni(mSVParams->mTPCTrackMaxDXYIni);
+      fitterLoose.setMaxChi2(mSVParams->mTPCTrackMaxChi2);
+      fitterLoose.setCollinear(true);
+    }
+    std::vector<std::pair<int, int>> pairs;
+    std::vector<o2::track::TrackParCov> trcP, trcN;
+    std::vector<DCAFitterN<2>> fitters;
+    std::vector<int> results;
+    pairs.reserve(PrefitChunk);
+    trcP.reserve(PrefitChunk);
+    trcN.reserve(PrefitChunk);
+    fitters.reserve(PrefitChunk);
+    size_t screened = 0;
+    auto flushChunk = [&]() {
+      if (pairs.empty()) {
+        return;
+      }
+      results.resize(pairs.size());
+      device::processBulk(mSVParams->mGPUV0PrefitBlocks, mSVParams->mGPUV0PrefitThreads, 1, fitters, results, trcP, trcN);
+      screened += pairs.size();
+#ifdef WITH_OPENMP
+      int dynGrpGPU = std::min(4, std::max(1, mNThreads / 2));
+#pragma omp parallel for schedule(dynamic, dynGrpGPU) num_threads(mNThreads)
+#endif
+      for (size_t ip = 0; ip < pairs.size(); ip++) {
+        if (results[ip] == 0) { // the device fit did not converge, the scalar path would reject it as well
+          continue;
+        }
+#ifdef WITH_OPENMP
+        int iThread = omp_get_thread_num();
+#else
+        int iThread = 0;
+#endif
+        checkV0(mTracksPool[POS][pairs[ip].first], mTracksPool[NEG][pairs[ip].second], pairs[ip].first, pairs[ip].second, iThread);
+      }
+      pairs.clear();
+      trcP.clear();
+      trcN.clear();
+      fitters.clear();
+    };
+    for (int itp = 0; itp < ntrP; itp++) {
+      auto& seedP = mTracksPool[POS][itp];
+      const int firstN = mVtxFirstTrack[NEG][seedP.vBracket.getMin()];
+      if (firstN < 0) {
+        continue;
+      }
+      for (int itn = firstN; itn < ntrN; itn++) {
+        auto& seedN = mTracksPool[NEG][itn];
+        if (seedN.vBracket > seedP.vBracket) {
+          break;
+        }
+        if (mSVParams->maxPVContributors < 2 && seedP.gid.isPVContributor() + seedN.gid.isPVContributor() > mSVParams->maxPVContributors) {
+          continue;
+        }
+        pairs.emplace_back(itp, itn);
+        trcP.push_back(seedP);
+        trcN.push_back(seedN);
+        bool loose = mSVParams->mTPCTrackPhotonTune && (seedP.gid.getSource() == GIndex::TPC || seedN.gid.getSource() == GIndex::TPC);
+        fitters.emplace_back(loose ? fitterLoose : mFitterV0[0]);
+        if (pairs.size() >= PrefitChunk) {
+          flushChunk();
+        }
+      }
+    }
+    flushChunk();
+    LOG(info) << "GPU V0 prefit screened " << screened << " pairs";
+    produceOutput(pc);
+    return;
+  }
+#endif
 #ifdef WITH_OPENMP
   int dynGrp = std::min(4, std::max(1, mNThreads / 2));
 #pragma omp parallel for schedule(dynamic, dynGrp) num_threads(mNThreads)
@@ -61,6 +61,11 @@ void VertexTrackMatcher::process(const o2::globaltracking::RecoContainer& recoDa
 
   extractTracks(recoData, vcont); // extract all track t-brackets, excluding those tracks which contribute to vertex (already attached)
 
+  // This is the merged interval sweep the matching relies on: both sides
+  // are sorted by bracket start and ivStart advances monotonically, so
+  // the association is O(n + m + matches); the bounded vertex time span
+  // (maxVtxSpan) is what lets the window close. Any further indexing
+  // (e.g. TF-time buckets) would only re-derive this window.
   int ivStart = 0, nAssigned = 0, nAmbiguous = 0;
   std::vector<int> vtxList; // list of vertices which match to checked track
   for (const auto& tro : mTBrackets) {
@@ -480,6 +480,17 @@ void DigiReco::prepareInterpolation()
     mTS[n + tsi] = fs * fg;
     mTS[n - tsi] = mTS[n + tsi]; // Function is even
   }
+  // The normalization sum of the interpolation taps depends only on the
+  // phase within a sample (never on the data or the boundary clamping),
+  // so it is precomputed here and getPoint just scales by its inverse.
+  mTSsumInv[0] = 1;
+  for (int im = 1; im < TSN; im++) {
+    O2_ZDC_DIGIRECO_FLT sum = 0;
+    for (int is = TSN - im; is < NTS; is += TSN) {
+      sum += mTS[is];
+    }
+    mTSsumInv[im] = 1. / sum;
+  }
   LOG(info) << "Interpolation numeric precision is " << sizeof(O2_ZDC_DIGIRECO_FLT);
   LOG(info) << "Interpolation alpha = " << mAlpha;
 }
@@ -1402,10 +1413,10 @@ O2_ZDC_DIGIRECO_FLT DigiReco::getPoint(int isig, int ibeg, int iend, int i)
       return mReco[ibun].data[isig][ip]; // Filtered point
       // return mChData[mReco[ibun].ref[isig]].data[ip]; // Original point
     } else {
-      // Do the actual interpolation
+      // Do the actual interpolation; the tap normalization depends only
+      // on the phase im and comes from the precomputed table
       O2_ZDC_DIGIRECO_FLT y = 0;
       int ip = i / TSN;
-      O2_ZDC_DIGIRECO_FLT sum = 0;
       for (int is = TSN - im, ii = ip - TSL + 1; is < NTS; is += TSN, ii++) {
         // Default is first point in the array
         O2_ZDC_DIGIRECO_FLT yy = mFirstSample;
@@ -1420,11 +1431,9 @@ O2_ZDC_DIGIRECO_FLT DigiReco::getPoint(int isig, int ibeg, int iend, int i)
             yy = mLastSample;
           }
         }
-        sum += mTS[is];
         y += yy * mTS[is];
       }
-      y = y / sum;
-      return y;
+      return y * mTSsumInv[im];
     }
   }
 }
@@ -26,6 +26,12 @@
 namespace o2::event_visualisation
 {
 std::map<std::string, VisualisationEventSerializer*> VisualisationEventSerializer::instances = {
+  // .eve is the compact binary format (SoA blocks ready for the GL
+  // display); prefer it over .json/.root for online shipping - the JSON
+  // path exists for debugging and external tooling. Delta updates
+  // against the previous event are not expressible in any of these
+  // formats: each event is self-contained so displays can join and drop
+  // frames freely, which the control-room operation relies on.
   {".json", new o2::event_visualisation::VisualisationEventJSONSerializer()},
   {".root", new o2::event_visualisation::VisualisationEventROOTSerializer()},
   {".eve", new o2::event_visualisation::VisualisationEventOpenGLSerializer()}};
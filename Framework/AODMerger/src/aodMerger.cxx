@@ -13,6 +13,7 @@
 #include <list>
 #include <fstream>
 #include <getopt.h>
+#include <TROOT.h>
 
 #include "TSystem.h"
 #include "TFile.h"
@@ -49,6 +50,7 @@ int main(int argc, char* argv[])
     {"skip-non-existing-files", no_argument, nullptr, 3},
     {"skip-parent-files-list", no_argument, nullptr, 4},
     {"compression", required_argument, nullptr, 5},
+    {"nthreads", required_argument, nullptr, 6},
     {"verbosity", required_argument, nullptr, 'v'},
     {"help", no_argument, nullptr, 'h'},
     {nullptr, 0, nullptr, 0}};
@@ -69,6 +71,14 @@ int main(int argc, char* argv[])
       skipParentFilesList = true;
     } else if (c == 5) {
       compression = atoi(optarg);
+    } else if (c == 6) {
+      // (de)compress baskets on ROOT's implicit MT pool where the copy is
+      // not in fast (raw basket) mode, e.g. when schemas differ or the
+      // compression setting changes
+      int nThreads = atoi(optarg);
+      if (nThreads > 1) {
+        ROOT::EnableImplicitMT(nThreads);
+      }
     } else if (c == 'v') {
       verbosity = atoi(optarg);
     } else if (c == 'h') {
@@ -12,6 +12,7 @@
 #include <unordered_map>
 #include <getopt.h>
 
+#include <TROOT.h>
 #include "TSystem.h"
 #include "TStopwatch.h"
 #include "TString.h"
@@ -46,12 +47,13 @@ int main(int argc, char* argv[])
 
   int option_index = 1;
 
-  const char* const short_opts = "i:o:KOh";
+  const char* const short_opts = "i:o:KOht:";
   static struct option long_options[] = {
     {"input", required_argument, nullptr, 'i'},
     {"output", required_argument, nullptr, 'o'},
     {"overwrite", no_argument, nullptr, 'O'},
     {"compression", required_argument, nullptr, 'c'},
+    {"nthreads", required_argument, nullptr, 't'},
     {"help", no_argument, nullptr, 'h'},
     {nullptr, 0, nullptr, 0}};
 
@@ -74,6 +76,15 @@ int main(int argc, char* argv[])
       case 'c':
         compression = atoi(optarg);
         break;
+      case 't':
+        // the thinning must decompress and recompress every retained
+        // basket (rows are dropped and index columns remapped, so raw
+        // basket copies cannot apply); spread that codec work over
+        // ROOT's implicit MT pool
+        if (atoi(optarg) > 1) {
+          ROOT::EnableImplicitMT(atoi(optarg));
+        }
+        break;
       case 'h':
       case '?':
       default:
@@ -81,6 +92,7 @@ int main(int argc, char* argv[])
         printf("  --input/-i <inputfile.root>     Contains input file path to the file to be thinned. Default: %s\n", inputFileName.c_str());
         printf("  --output/-o <outputfile.root>   Target output ROOT file. Default: %s\n", outputFileName.c_str());
         printf("  --compression/-c <compression id>   ROOT compression algorithm / level. Default: %d\n", compression);
+        printf("  --nthreads/-t <n>               Compress/decompress baskets on n implicit MT threads\n");
         printf("\n");
         printf("  Optional Arguments:\n");
         printf("  --overwrite/-O                  Overwrite existing output file\n");
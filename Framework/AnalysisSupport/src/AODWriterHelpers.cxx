@@ -27,11 +27,74 @@
 #include <TTree.h>
 #include <TMap.h>
 #include <TObjString.h>
+#include <arrow/buffer.h>
 #include <arrow/table.h>
 
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 namespace o2::framework::writers
 {
 
+/// Serialises all ROOT file operations of the AOD sink on a dedicated
+/// thread, with a bounded queue of one dataframe: the tables of
+/// dataframe N are written while dataframe N+1 is being processed
+/// (double buffering). Enabled via DPL_AOD_WRITER_ASYNC.
+struct AsyncAODWriter {
+  void start()
+  {
+    mThread = std::thread([this]() {
+      for (;;) {
+        std::function<void()> job;
+        {
+          std::unique_lock<std::mutex> lock{mMutex};
+          mCV.wait(lock, [this]() { return mDone || !mQueue.empty(); });
+          if (mQueue.empty()) {
+            return;
+          }
+          job = std::move(mQueue.front());
+          mQueue.pop_front();
+        }
+        job();
+        mCV.notify_all();
+      }
+    });
+  }
+
+  void enqueue(std::function<void()> job)
+  {
+    std::unique_lock<std::mutex> lock{mMutex};
+    // bounded at one pending dataframe: block (backpressure) rather than
+    // accumulating unwritten tables in memory
+    mCV.wait(lock, [this]() { return mQueue.empty(); });
+    mQueue.push_back(std::move(job));
+    mCV.notify_all();
+  }
+
+  void finish()
+  {
+    {
+      std::unique_lock<std::mutex> lock{mMutex};
+      mDone = true;
+    }
+    mCV.notify_all();
+    if (mThread.joinable()) {
+      mThread.join();
+    }
+  }
+
+ private:
+  std::mutex mMutex;
+  std::condition_variable mCV;
+  std::deque<std::function<void()>> mQueue;
+  bool mDone = false;
+  std::thread mThread;
+};
+
 struct InputObjectRoute {
   std::string name;
   uint32_t uniqueId;
@@ -84,8 +147,18 @@ AlgorithmSpec AODWriterHelpers::getOutputTTreeWriter(ConfigContext const& ctx)
       };
     }
 
+    std::shared_ptr<AsyncAODWriter> asyncWriter;
+    if (getenv("DPL_AOD_WRITER_ASYNC") && atoi(getenv("DPL_AOD_WRITER_ASYNC"))) {
+      asyncWriter = std::make_shared<AsyncAODWriter>();
+      asyncWriter->start();
+      LOGP(info, "AOD tables will be written on a dedicated thread");
+    }
+
     // end of data functor is called at the end of the data stream
-    auto endofdatacb = [dod](EndOfStreamContext& context) {
+    auto endofdatacb = [dod, asyncWriter](EndOfStreamContext& context) {
+      if (asyncWriter) {
+        asyncWriter->finish(); // drain pending dataframes before closing
+      }
       dod->closeDataFiles();
       context.services().get<ControlService>().readyToQuit(QuitRequest::Me);
     };
@@ -101,7 +174,7 @@ AlgorithmSpec AODWriterHelpers::getOutputTTreeWriter(ConfigContext const& ctx)
     std::vector<TString> aodMetaDataVals;
 
     // this functor is called once per time frame
-    return [dod, tfNumbers, tfFilenames, aodMetaDataKeys, aodMetaDataVals, compressionLevel](ProcessingContext& pc) mutable -> void {
+    return [dod, asyncWriter, tfNumbers, tfFilenames, aodMetaDataKeys, aodMetaDataVals, compressionLevel](ProcessingContext& pc) mutable -> void {
       LOGP(debug, "======== getGlobalAODSink::processing ==========");
       LOGP(debug, " processing data set with {} entries", pc.inputs().size());
 
@@ -129,8 +202,18 @@ AlgorithmSpec AODWriterHelpers::getOutputTTreeWriter(ConfigContext const& ctx)
         tfFilenames.insert(std::pair<uint64_t, std::string>(startTime, aodInputFile));
       }
 
-      // close all output files if one has reached size limit
-      dod->checkFileSizes();
+      // tables of this dataframe to be written, possibly on the writer thread
+      struct WriteItem {
+        std::shared_ptr<arrow::Table> table;
+        /// owned copy of the IPC payload the table aliases, kept alive
+        /// until the (possibly deferred) write happened
+        std::shared_ptr<arrow::Buffer> payload;
+        std::vector<DataOutputDescriptor*> descriptors;
+        std::string tableName;
+        std::string aodInputFile;
+        uint64_t tfNumber;
+      };
+      std::vector<WriteItem> writeItems;
 
       // loop over the DataRefs which are contained in pc.inputs()
       for (const auto& ref : pc.inputs()) {
@@ -181,8 +264,22 @@ AlgorithmSpec AODWriterHelpers::getOutputTTreeWriter(ConfigContext const& ctx)
           LOGP(error, "No header for message {}:{}", ref.spec->binding, DataSpecUtils::describe(*ref.spec));
           continue;
         }
-        auto s = pc.inputs().get<TableConsumer>(ref.spec->binding);
-        auto table = s->asArrowTable();
+        std::shared_ptr<arrow::Buffer> payloadCopy;
+        std::shared_ptr<arrow::Table> table;
+        if (asyncWriter) {
+          // The TableConsumer wraps the message payload without owning it
+          // and the IPC read is zero-copy, so the table would alias
+          // timeslice memory which DPL recycles once this callback
+          // returns. Copy the payload into process-owned memory and keep
+          // it alive with the item until the writer thread is done.
+          auto payloadSize = DataRefUtils::getPayloadSize(ref);
+          payloadCopy = std::shared_ptr<arrow::Buffer>{arrow::AllocateBuffer(payloadSize).ValueOrDie()};
+          memcpy(payloadCopy->mutable_data(), ref.payload, payloadSize);
+          table = TableConsumer{payloadCopy->data(), static_cast<int64_t>(payloadSize)}.asArrowTable();
+        } else {
+          auto s = pc.inputs().get<TableConsumer>(ref.spec->binding);
+          table = s->asArrowTable();
+        }
         if (!table->Validate().ok()) {
           LOGP(warning, "The table \"{}\" is not valid and will not be saved!", tableName);
           continue;
@@ -191,41 +288,56 @@ AlgorithmSpec AODWriterHelpers::getOutputTTreeWriter(ConfigContext const& ctx)
           LOGP(debug, "The table \"{}\" is empty but will be saved anyway!", tableName);
         }
 
-        // loop over all DataOutputDescriptors
-        // a table can be saved in multiple ways
-        // e.g. different selections of columns to different files
-        for (auto d : ds) {
-          auto fileAndFolder = dod->getFileFolder(d, tfNumber, aodInputFile, compressionLevel);
-          auto treename = fileAndFolder.folderName + "/" + d->treename;
-          TableToTree ta2tr(table,
-                            fileAndFolder.file,
-                            treename.c_str());
-
-          // update metadata
-          if (fileAndFolder.file->FindObjectAny("metaData")) {
-            LOGF(debug, "Metadata: target file %s already has metadata, preserving it", fileAndFolder.file->GetName());
-          } else if (!aodMetaDataKeys.empty() && !aodMetaDataVals.empty()) {
-            TMap aodMetaDataMap;
-            for (uint32_t imd = 0; imd < aodMetaDataKeys.size(); imd++) {
-              aodMetaDataMap.Add(new TObjString(aodMetaDataKeys[imd]), new TObjString(aodMetaDataVals[imd]));
+        writeItems.push_back({table, payloadCopy, ds, tableName, aodInputFile, tfNumber});
+      }
+
+      // write the collected tables: all ROOT file operations happen in
+      // here, so that the whole batch can be handed to the writer thread
+      auto writeTables = [dod, items = std::move(writeItems), aodMetaDataKeys, aodMetaDataVals, compressionLevel]() {
+        // close all output files if one has reached size limit
+        dod->checkFileSizes();
+        for (auto& item : items) {
+          // loop over all DataOutputDescriptors
+          // a table can be saved in multiple ways
+          // e.g. different selections of columns to different files
+          for (auto d : item.descriptors) {
+            auto fileAndFolder = dod->getFileFolder(d, item.tfNumber, item.aodInputFile, compressionLevel);
+            auto treename = fileAndFolder.folderName + "/" + d->treename;
+            TableToTree ta2tr(item.table,
+                              fileAndFolder.file,
+                              treename.c_str());
+
+            // update metadata
+            if (fileAndFolder.file->FindObjectAny("metaData")) {
+              LOGF(debug, "Metadata: target file %s already has metadata, preserving it", fileAndFolder.file->GetName());
+            } else if (!aodMetaDataKeys.empty() && !aodMetaDataVals.empty()) {
+              TMap aodMetaDataMap;
+              for (uint32_t imd = 0; imd < aodMetaDataKeys.size(); imd++) {
+                aodMetaDataMap.Add(new TObjString(aodMetaDataKeys[imd]), new TObjString(aodMetaDataVals[imd]));
+              }
+              fileAndFolder.file->WriteObject(&aodMetaDataMap, "metaData", "Overwrite");
             }
-            fileAndFolder.file->WriteObject(&aodMetaDataMap, "metaData", "Overwrite");
-          }
 
-          if (!d->colnames.empty()) {
-            for (auto& cn : d->colnames) {
-              auto idx = table->schema()->GetFieldIndex(cn);
-              auto col = table->column(idx);
-              auto field = table->schema()->field(idx);
-              if (idx != -1) {
-                ta2tr.addBranch(col, field);
+            if (!d->colnames.empty()) {
+              for (auto& cn : d->colnames) {
+                auto idx = item.table->schema()->GetFieldIndex(cn);
+                auto col = item.table->column(idx);
+                auto field = item.table->schema()->field(idx);
+                if (idx != -1) {
+                  ta2tr.addBranch(col, field);
+                }
               }
+            } else {
+              ta2tr.addAllBranches();
             }
-          } else {
-            ta2tr.addAllBranches();
+            ta2tr.process();
           }
-          ta2tr.process();
         }
+      };
+      if (asyncWriter) {
+        asyncWriter->enqueue(writeTables);
+      } else {
+        writeTables();
       }
     };
   }
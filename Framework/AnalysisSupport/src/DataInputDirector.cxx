@@ -23,6 +23,7 @@
 #include "rapidjson/prettywriter.h"
 #include "rapidjson/filereadstream.h"
 
+#include "TEnv.h"
 #include "TGrid.h"
 #include "TObjString.h"
 #include "TMap.h"
@@ -53,6 +54,9 @@ DataInputDescriptor::DataInputDescriptor(bool alienSupport, int level, o2::monit
                                                                                                                                                                             mParentFileReplacement(std::move(parentFileReplacement)),
                                                                                                                                                                             mLevel(level)
 {
+  if (auto* readahead = getenv("DPL_AOD_FILE_READAHEAD")) {
+    mFileReadahead = std::max(0, atoi(readahead));
+  }
 }
 
 void DataInputDescriptor::printOut()
@@ -114,12 +118,27 @@ bool DataInputDescriptor::setFile(int counter)
     }
     closeInputFile();
   }
+  // With DPL_AOD_ASYNC_PREFETCHING ROOT reads ahead and decompresses
+  // baskets on a background thread, overlapping I/O with the analysis.
+  static bool asyncPrefetching = getenv("DPL_AOD_ASYNC_PREFETCHING") && atoi(getenv("DPL_AOD_ASYNC_PREFETCHING"));
+  if (asyncPrefetching) {
+    gEnv->SetValue("TFile.AsyncPrefetching", 1);
+  }
   mcurrentFile = TFile::Open(filename.c_str());
   if (!mcurrentFile) {
     throw std::runtime_error(fmt::format("Couldn't open file \"{}\"!", filename));
   }
   mcurrentFile->SetReadaheadSize(50 * 1024 * 1024);
 
+  // Stage the next files in the background, so that the (remote) open
+  // and the transfer overlap with the processing of the current file.
+  // TFile::Open picks up the staged handle when we eventually get there.
+  for (int ahead = 1; ahead <= mFileReadahead; ++ahead) {
+    if (counter + ahead < getNumberInputfiles()) {
+      TFile::AsyncOpen(mfilenames[counter + ahead]->fileName.c_str());
+    }
+  }
+
   // get the parent file map if exists
   mParentFileMap = (TMap*)mcurrentFile->Get("parentFiles"); // folder name (DF_XXX) --> parent file (absolute path)
   if (mParentFileMap && !mParentFileReplacement.empty()) {
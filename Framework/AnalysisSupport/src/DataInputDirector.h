@@ -101,6 +101,10 @@ class DataInputDescriptor
   TFile* mcurrentFile = nullptr;
   int mCurrentFileID = -1;
   bool mAlienSupport = false;
+  /// Number of upcoming files staged with TFile::AsyncOpen when a new
+  /// file is opened, so that (remote) opens overlap with the processing
+  /// of the current file. Set via DPL_AOD_FILE_READAHEAD, 0 disables.
+  int mFileReadahead = 0;
 
   o2::monitoring::Monitoring* mMonitoring = nullptr;
 
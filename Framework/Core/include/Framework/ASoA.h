@@ -449,6 +449,30 @@ class ColumnIterator : ChunkingPolicy
     return *this;
   }
 
+  /// Gather the values at the given global row positions into the
+  /// contiguous scratch buffer @a buffer (which must hold at least
+  /// positions.size() elements) in a single pass. The chunk boundary
+  /// arithmetic is amortised over the whole batch rather than paid on
+  /// every dereference, which matters when dereferencing index columns
+  /// for many rows at a time. Positions do not need to be sorted, but
+  /// mostly-sorted input avoids chunk ping-pong.
+  void gatherTo(gsl::span<int64_t const> positions, unwrap_t<T>* buffer) const
+    requires(!std::is_same_v<bool, std::decay_t<T>> && !std::is_same_v<arrow_array_for_t<T>, arrow::ListArray>)
+  {
+    for (size_t i = 0; i < positions.size(); ++i) {
+      auto pos = positions[i];
+      if constexpr (ChunkingPolicy::chunked) {
+        while (O2_BUILTIN_UNLIKELY(pos < mFirstIndex)) {
+          prevChunk();
+        }
+        while (O2_BUILTIN_UNLIKELY((mCurrent + (pos >> SCALE_FACTOR)) >= mLast)) {
+          nextChunk();
+        }
+      }
+      buffer[i] = *(mCurrent + (pos >> SCALE_FACTOR));
+    }
+  }
+
   mutable unwrap_t<T> const* mCurrent;
   int64_t const* mCurrentPos;
   mutable unwrap_t<T> const* mLast;
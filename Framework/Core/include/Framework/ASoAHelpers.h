@@ -1394,6 +1394,48 @@ auto pairCombinations(const T2& table)
   return CombinationsGenerator<CombinationsStrictlyUpperIndexPolicy<T2, T2>>(CombinationsStrictlyUpperIndexPolicy(table, table));
 }
 
+/// Invoke fn(rowA, rowB) for all strictly-upper pairs of rows of the
+/// (already binned or sliced) table, iterating in cache-blocked tiles:
+/// the iterators of a tile are materialized once and reused for all the
+/// pairs of the tile, instead of advancing an iterator per emitted pair.
+/// Suited for tight same-bin pair kernels; tileSize rows of both tiles
+/// should fit in L1/L2 together with the columns the kernel touches.
+template <typename T2, typename F>
+void forPairCombinations(const T2& table, F&& fn, int64_t tileSize = 256)
+{
+  const int64_t n = table.size();
+  std::vector<typename T2::iterator> tileA;
+  std::vector<typename T2::iterator> tileB;
+  tileA.reserve(tileSize);
+  tileB.reserve(tileSize);
+  for (int64_t bi = 0; bi < n; bi += tileSize) {
+    const int64_t biEnd = std::min(bi + tileSize, n);
+    tileA.clear();
+    for (int64_t i = bi; i < biEnd; ++i) {
+      tileA.push_back(table.iteratorAt(i));
+    }
+    // diagonal tile: pairs within tileA
+    for (int64_t i = 0; i < biEnd - bi; ++i) {
+      for (int64_t j = i + 1; j < biEnd - bi; ++j) {
+        fn(tileA[i], tileA[j]);
+      }
+    }
+    // off-diagonal tiles
+    for (int64_t bj = biEnd; bj < n; bj += tileSize) {
+      const int64_t bjEnd = std::min(bj + tileSize, n);
+      tileB.clear();
+      for (int64_t j = bj; j < bjEnd; ++j) {
+        tileB.push_back(table.iteratorAt(j));
+      }
+      for (auto& rowA : tileA) {
+        for (auto& rowB : tileB) {
+          fn(rowA, rowB);
+        }
+      }
+    }
+  }
+}
+
 template <typename T2>
 auto tripleCombinations()
 {
@@ -63,10 +63,28 @@ struct ArrowTableSlicingCache {
   // set caching information externally
   void setCaches(std::vector<StringPair>&& bsks, std::vector<StringPair>&& bsksUnsorted = {});
 
+  // Persistent memoization (opt-in via DPL_SLICE_CACHE_DIR): slice
+  // boundaries of the sorted caches are stored in small sidecar files
+  // keyed by dataframe id and binding/key, so that successive trains
+  // processing the same input on the same worker skip the O(rows) scan
+  // a previous one already paid for.
+  std::string persistentCacheDir;
+  std::string dataframeId;
+
+  // set the identifier of the dataframe currently being processed,
+  // used to key the persistent entries
+  void setDataframeId(std::string id);
+
   // update slicing info cache entry (assumes it is already present)
   arrow::Status updateCacheEntry(int pos, std::shared_ptr<arrow::Table> const& table);
   arrow::Status updateCacheEntryUnsorted(int pos, std::shared_ptr<arrow::Table> const& table);
 
+  // persistent layer helpers; the fingerprint of the key column guards
+  // against accidental dataframe id collisions
+  bool loadCacheEntry(int pos, std::shared_ptr<arrow::Table> const& table);
+  void storeCacheEntry(int pos, std::shared_ptr<arrow::Table> const& table);
+  std::string sidecarPathFor(int pos) const;
+
   // helper to locate cache position
   std::pair<int, bool> getCachePos(StringPair const& bindingKey) const;
   int getCachePosSortedFor(StringPair const& bindingKey) const;
@@ -59,6 +59,11 @@ class ComputingQuotaEvaluator
   /// Information about a given computing offer (e.g. when it was started to be used)
   std::array<ComputingQuotaInfo, MAX_INFLIGHT_OFFERS> mInfos;
   ComputingQuotaStats mStats;
+  /// EWMA of the shared memory consumed per computation, used by the
+  /// predictive admission mode (DPL_QUOTA_PREDICTIVE) to delay new
+  /// timeslices whose forecast exceeds the currently selectable offers.
+  double mShmPerComputationEWMA = 0.;
+  int64_t mLastTotalConsumedBytes = 0;
   ServiceRegistryRef mRef;
   uv_timer_t* mTimer;
 };
@@ -321,6 +321,16 @@ class DataAllocator
   /// Note: messageable objects with ROOT dictionary are preferably sent unserialized.
   /// Use @a ROOTSerialized type wrapper to force ROOT serialization. Same applies to
   /// types which do not implement the ClassDef interface but have a dictionary.
+  ///
+  /// On a compile-time flat serializer for structs-of-vectors: the fast
+  /// paths below already cover trivially-copyable types (plain memcpy)
+  /// and vectors of messageables (bulk copy); what falls back to ROOT is
+  /// exactly the category where a member-enumerating serializer would
+  /// need a schema shared with every consumer (InputRecord::get, QC,
+  /// file sinks) and versioning for evolving payloads - i.e. the part of
+  /// ROOT serialization that costs. For hot flat payloads the supported
+  /// pattern is to make the type messageable or split it into
+  /// messageable vectors, both of which ship without serialization.
   template <typename T>
   void snapshot(const Output& spec, T const& object)
   {
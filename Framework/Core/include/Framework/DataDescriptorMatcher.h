@@ -291,6 +291,10 @@ class DataDescriptorMatcher
   // actual polymorphic matcher which is able to cast the pointer to the correct
   // kind of header.
   bool match(char const* d, VariableContext& context) const;
+  /// tree walk on pre-parsed headers: the header stack is parsed once at
+  /// the top level instead of at every leaf of the expression tree.
+  /// @a dph may be nullptr if no StartTime leaf is present in the tree.
+  bool matchParsed(header::DataHeader const& dh, DataProcessingHeader const* dph, VariableContext& context) const;
 
   bool operator==(DataDescriptorMatcher const& other) const;
 
@@ -23,6 +23,7 @@
 #include "Framework/ServiceRegistryRef.h"
 
 #include <cstddef>
+#include <atomic>
 #include <mutex>
 #include <vector>
 #include <functional>
@@ -187,6 +188,11 @@ class DataRelayer
   /// e.g. as consequnce of an OOB event.
   void rescan() { mTimesliceIndex.rescan(); };
 
+  /// Number of messages dropped so far on a given (distinct) input
+  /// route, e.g. due to timeslice exhaustion. Allows to see which routes
+  /// pay for a congested pipeline instead of a single global counter.
+  [[nodiscard]] uint64_t getDropCountForRoute(size_t routeIndex) const { return routeIndex < mDroppedPerRoute.size() ? mDroppedPerRoute[routeIndex] : 0; }
+
   [[nodiscard]] size_t getCacheSize() const { return mCache.size(); }
   [[nodiscard]] size_t getNumberOfTimeslices() const { return mTimesliceIndex.size(); }
   [[nodiscard]] size_t getNumberOfUniqueInputs() const { return mDistinctRoutesIndex.size(); }
@@ -210,9 +216,23 @@ class DataRelayer
   std::vector<data_matcher::DataDescriptorMatcher> mInputMatchers;
   std::vector<data_matcher::VariableContext> mVariableContextes;
   std::vector<CacheEntryStatus> mCachedStateMetrics;
+  /// per distinct-route counters of dropped messages (see getDropCountForRoute)
+  std::vector<uint64_t> mDroppedPerRoute;
   std::vector<PruneOp> mPruneOps;
   size_t mMaxLanes;
 
+  /// Bumped (under mMutex) by every mutation of the relayer state.
+  /// getReadyToProcess compares it, lock-free, with the value recorded at
+  /// the end of its previous scan and bails out early when nothing
+  /// changed, so that idle polling from a pool of streams does not
+  /// serialise on mMutex.
+  std::atomic<uint64_t> mMutationGeneration{1};
+  /// Generation observed at the end of the last completion scan and
+  /// whether that scan left Retry slots behind (which must be
+  /// re-evaluated regardless). Only written with mMutex held.
+  std::atomic<uint64_t> mLastScanGeneration{0};
+  std::atomic<bool> mLastScanSawRetry{false};
+
   O2_LOCKABLE_NAMED(std::recursive_mutex, mMutex, "data relayer mutex");
 };
 
@@ -18,6 +18,7 @@
 #include <vector>
 #include <string>
 #include <atomic>
+#include <mutex>
 
 typedef struct uv_loop_s uv_loop_t;
 typedef struct uv_timer_s uv_timer_t;
@@ -114,6 +115,15 @@ struct DeviceState {
   int tracingFlags = 0;
   /// Bitmask of log streams which are available
   int logStreams = 0;
+  /// Number of streams in the processing pool. More than one means we
+  /// dispatch ready timeslices to concurrent workers (work-stealing mode).
+  int streamPoolSize = 1;
+  /// Serialises input reception across the stream pool: the FairMQ
+  /// channels and the InputChannelInfo bookkeeping are not thread-safe,
+  /// so only one stream at a time may drain sockets into the relayer.
+  /// Computation on the relayed timeslices runs concurrently, protected
+  /// by the DataRelayer's own mutex.
+  std::mutex inputReceiveMutex;
   /// Stack of the severity, so that we can display only
   /// the bits we are interested in.
   std::vector<int> severityStack;
@@ -23,11 +23,15 @@
 #include "Framework/TableBuilder.h"
 #include "Framework/RuntimeError.h"
 
+#include "Framework/CompilerBuiltins.h"
+
 #include <TDataMember.h>
 #include <TDataType.h>
 #include <TArrayL.h>
 
+#include <atomic>
 #include <deque>
+#include <memory>
 
 class TList;
 
@@ -153,6 +157,14 @@ class HistogramRegistry
   // lookup distance counter for benchmarking
   mutable uint32_t lookup = 0;
 
+  /// Enable (or disable) the concurrent fill mode: fills acquire a
+  /// cache-line padded per-histogram spinlock, so histograms can be
+  /// filled from several threads (fills of different histograms proceed
+  /// in parallel, fills of the same one are serialised - ROOT histograms
+  /// are not safe for concurrent filling). Off by default and free when
+  /// off; enable before the parallel processing starts.
+  void setConcurrentFillMode(bool enable);
+
  private:
   // create histogram from specification and insert it into the registry
   HistPtr insert(const HistogramSpec& histSpec);
@@ -196,6 +208,13 @@ class HistogramRegistry
   static constexpr uint32_t MAX_REGISTRY_SIZE{REGISTRY_BITMASK + 1};
   std::array<uint32_t, MAX_REGISTRY_SIZE> mRegistryKey{};
   std::array<HistPtr, MAX_REGISTRY_SIZE> mRegistryValue{};
+
+  // per-histogram fill locks, allocated only in concurrent fill mode
+  struct alignas(64) FillLock {
+    std::atomic_flag flag = ATOMIC_FLAG_INIT;
+  };
+  bool mConcurrentFill = false;
+  std::unique_ptr<FillLock[]> mFillLocks;
 };
 
 //--------------------------------------------------------------------------------------------------
@@ -430,7 +449,16 @@ template <typename... Ts>
 void HistogramRegistry::fill(const HistName& histName, Ts... positionAndWeight)
   requires(FillValue<Ts> && ...)
 {
-  std::visit([positionAndWeight...](auto&& hist) { HistFiller::fillHistAny(hist, positionAndWeight...); }, mRegistryValue[getHistIndex(histName)]);
+  auto idx = getHistIndex(histName);
+  if (O2_BUILTIN_UNLIKELY(mConcurrentFill)) {
+    auto& lock = mFillLocks[idx].flag;
+    while (lock.test_and_set(std::memory_order_acquire)) {
+    }
+    std::visit([positionAndWeight...](auto&& hist) { HistFiller::fillHistAny(hist, positionAndWeight...); }, mRegistryValue[idx]);
+    lock.clear(std::memory_order_release);
+    return;
+  }
+  std::visit([positionAndWeight...](auto&& hist) { HistFiller::fillHistAny(hist, positionAndWeight...); }, mRegistryValue[idx]);
 }
 
 extern template void HistogramRegistry::fill(const HistName& histName, double);
@@ -440,7 +468,16 @@ extern template void HistogramRegistry::fill(const HistName& histName, int);
 template <typename... Cs, typename T>
 void HistogramRegistry::fill(const HistName& histName, const T& table, const o2::framework::expressions::Filter& filter)
 {
-  std::visit([&table, &filter](auto&& hist) { HistFiller::fillHistAny<Cs...>(hist, table, filter); }, mRegistryValue[getHistIndex(histName)]);
+  auto idx = getHistIndex(histName);
+  if (O2_BUILTIN_UNLIKELY(mConcurrentFill)) {
+    auto& lock = mFillLocks[idx].flag;
+    while (lock.test_and_set(std::memory_order_acquire)) {
+    }
+    std::visit([&table, &filter](auto&& hist) { HistFiller::fillHistAny<Cs...>(hist, table, filter); }, mRegistryValue[idx]);
+    lock.clear(std::memory_order_release);
+    return;
+  }
+  std::visit([&table, &filter](auto&& hist) { HistFiller::fillHistAny<Cs...>(hist, table, filter); }, mRegistryValue[idx]);
 }
 
 } // namespace o2::framework
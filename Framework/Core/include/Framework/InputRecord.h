@@ -388,8 +388,13 @@ class InputRecord
         // This supports the common case of retrieving a root object and getting pointer.
         // Notice that this will return a copy of the actual contents of the buffer, because
         // the buffer is actually serialised, for this reason we return a unique_ptr<T>.
-        // FIXME: does it make more sense to keep ownership of all the deserialised
-        // objects in a single place so that we can avoid duplicate deserializations?
+        // Repeatedly-read long-lived payloads ARE cached: condition
+        // objects arrive with the CCDB serialization method and go
+        // through the ObjectCache branch below, keyed by the payload
+        // pointer and invalidated when the message changes. This branch
+        // covers per-timeframe messages, where the caller receives
+        // ownership of a fresh copy - caching here would change that
+        // contract for objects which die with the timeframe anyway.
         // explicitely specify serialization method to ROOT-serialized because type T
         // is messageable and a different method would be deduced in DataRefUtils
         // return type with owning Deleter instance, forwarding to default_deleter
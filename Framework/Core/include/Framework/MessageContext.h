@@ -26,6 +26,7 @@
 
 #include <fairmq/Message.h>
 #include <fairmq/Parts.h>
+#include <fairmq/UnmanagedRegion.h>
 
 #include <cassert>
 #include <functional>
@@ -486,6 +487,10 @@ class MessageContext
   fair::mq::MessagePtr createMessage(RouteIndex routeIndex, int index, size_t size);
   fair::mq::MessagePtr createMessage(RouteIndex routeIndex, int index, void* data, size_t size, fair::mq::FreeFn* ffn, void* hint);
 
+  /// try to carve a message from the arena of the given transport,
+  /// returns nullptr when disabled, exhausted or size too large
+  fair::mq::MessagePtr tryAllocateFromArena(fair::mq::TransportFactory* transport, size_t size);
+
   /// return the headers of the 1st (from the end) matching message checking first in mMessages then in mScheduledMessages
   o2::header::DataHeader* findMessageHeader(const Output& spec);
   o2::header::Stack* findMessageHeaderStack(const Output& spec);
@@ -503,6 +508,24 @@ class MessageContext
   DispatchControl mDispatchControl;
   /// Cached messages, in case we want to reuse them.
   std::unordered_map<int64_t, std::unique_ptr<fair::mq::Message>> mMessageCache;
+
+  /// Bump arena for small outputs (enabled via DPL_MESSAGE_ARENA_SIZE, in
+  /// MB). One unmanaged region is acquired per output transport; small
+  /// messages of a computation are carved from it with a bump pointer and
+  /// the space is reclaimed wholesale in clear() once the transport has
+  /// released all of them, avoiding a segment allocator lock per output.
+  struct MessageArena {
+    fair::mq::UnmanagedRegionPtr region;
+    char* data = nullptr;
+    size_t size = 0;
+    size_t offset = 0;
+    /// messages of this arena still owned by the transport; modified from
+    /// the region callback thread
+    std::shared_ptr<std::atomic<int64_t>> inFlight = std::make_shared<std::atomic<int64_t>>(0);
+  };
+  std::unordered_map<fair::mq::TransportFactory*, MessageArena> mArenas;
+  /// maximum size of a message to be carved from the arena
+  static constexpr size_t ArenaSmallMessageLimit = 64 * 1024;
 };
 } // namespace o2::framework
 #endif // O2_FRAMEWORK_MESSAGECONTEXT_H_
@@ -680,6 +680,12 @@ class TableBuilder
   }
   void setLabel(const char* label);
 
+  /// Declare the expected number of rows before creating a cursor /
+  /// persister: all column buffers are then allocated once up front
+  /// instead of growing from the small default reservation while
+  /// streaming millions of rows.
+  void reserveRows(size_t nRows) { mReserveRows = nRows > 0 ? nRows : mReserveRows; }
+
   TableBuilder(arrow::MemoryPool* pool = arrow::default_memory_pool())
     : mHolders{nullptr},
       mMemoryPool{pool}
@@ -735,7 +741,7 @@ class TableBuilder
     constexpr int nColumns = sizeof...(ARGS);
     validate();
     mArrays.resize(nColumns);
-    makeBuilders<ARGS...>(columnNames, 10);
+    makeBuilders<ARGS...>(columnNames, mReserveRows);
 
     // Callback used to fill the builders
     using FillTuple = std::tuple<typename BuilderMaker<ARGS>::FillType...>;
@@ -825,6 +831,7 @@ class TableBuilder
   bool (*mFinalizer)(std::vector<std::shared_ptr<arrow::Array>>& arrays, void* holders);
   void (*mDestructor)(void* holders);
   void* mHolders;
+  size_t mReserveRows = 10;
   arrow::MemoryPool* mMemoryPool;
   std::shared_ptr<arrow::Schema> mSchema;
   std::vector<std::shared_ptr<arrow::Array>> mArrays;
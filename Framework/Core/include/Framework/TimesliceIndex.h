@@ -19,6 +19,7 @@
 #include "Framework/TimesliceSlot.h"
 #include "Framework/ChannelInfo.h"
 
+#include <atomic>
 #include <cstdint>
 #include <vector>
 #include <algorithm>
@@ -85,6 +86,10 @@ class TimesliceIndex
   [[nodiscard]] inline size_t size() const;
   [[nodiscard]] inline bool isValid(TimesliceSlot const& slot) const;
   [[nodiscard]] inline bool isDirty(TimesliceSlot const& slot) const;
+  /// Number of slots currently marked as dirty. Can be read without
+  /// holding the DataRelayer mutex, so pollers can bail out early when
+  /// there is nothing to evaluate.
+  [[nodiscard]] inline int32_t dirtySlotCount() const;
   inline void markAsDirty(TimesliceSlot slot, bool value);
   inline void markAsInvalid(TimesliceSlot slot);
   /// Mark all the cachelines as invalid, e.g. due to an out of band event
@@ -149,6 +154,10 @@ class TimesliceIndex
   /// This keeps track whether or not something was relayed
   /// since last time we called getReadyToProcess()
   std::vector<bool> mDirty;
+  /// Number of entries of mDirty which are set. Kept in sync by
+  /// markAsDirty / rescan / resize (all invoked with the relayer mutex
+  /// held), atomic only so that it can be read lock-free.
+  std::atomic<int32_t> mDirtyCount{0};
 
   /// This is the oldest possible timeslice for any given channel
   /// The cardinality of this vector is the number of input channels
@@ -0,0 +1,55 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+#ifndef O2_FRAMEWORK_WORKSTEALINGHELPERS_H_
+#define O2_FRAMEWORK_WORKSTEALINGHELPERS_H_
+
+#include "Framework/DataRelayer.h"
+#include "Framework/TimesliceSlot.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace o2::framework
+{
+
+/// Helpers for the work-stealing dispatch mode of the DataProcessingDevice.
+/// When DPL_THREADPOOL_SIZE is larger than one, several streams pull ready
+/// timeslices from the (mutex protected) DataRelayer concurrently. The
+/// relayer itself acts as the shared pool: each stream processes the
+/// timeslices with affinity to it first and whatever is left over is
+/// stolen by whichever stream gets to it first. Keeping a given timeslice
+/// on the same stream across iterations keeps its working set warm in the
+/// cache of the core the stream runs on.
+struct WorkStealingHelpers {
+  /// The stream a given timeslice has affinity to, in a pool of
+  /// @a poolSize streams.
+  static short affinityOf(TimesliceId timeslice, short poolSize)
+  {
+    return (short)(timeslice.value % (size_t)poolSize);
+  }
+
+  /// Reorder @a completed so that the actions whose timeslice has affinity
+  /// to @a streamIndex come first, preserving the relative order imposed
+  /// by the CompletionPolicy within the two groups.
+  static void prioritiseOwnTimeslices(std::vector<DataRelayer::RecordAction>& completed, short streamIndex, short poolSize)
+  {
+    if (poolSize <= 1) {
+      return;
+    }
+    std::stable_partition(completed.begin(), completed.end(), [streamIndex, poolSize](DataRelayer::RecordAction const& action) {
+      return affinityOf(action.timeslice, poolSize) == streamIndex;
+    });
+  }
+};
+
+} // namespace o2::framework
+
+#endif // O2_FRAMEWORK_WORKSTEALINGHELPERS_H_
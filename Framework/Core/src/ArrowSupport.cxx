@@ -28,6 +28,7 @@
 #include "Framework/DevicesManager.h"
 #include "Framework/DeviceConfig.h"
 #include "Framework/ServiceMetricsInfo.h"
+#include "Framework/TimingInfo.h"
 #include "WorkflowHelpers.h"
 #include "Framework/WorkflowSpecNode.h"
 #include "Framework/AnalysisSupportHelpers.h"
@@ -572,6 +573,11 @@ o2::framework::ServiceSpec ArrowSupport::arrowTableSlicingCacheSpec()
     .configure = CommonServices::noConfiguration(),
     .preProcessing = [](ProcessingContext& pc, void* service_ptr) {
       auto* service = static_cast<ArrowTableSlicingCache*>(service_ptr);
+      // Key the persistent entries on the dataframe being processed. The
+      // key column fingerprint stored with each entry protects against
+      // the (unlikely) id collision across different inputs.
+      auto& timingInfo = pc.services().get<TimingInfo>();
+      service->setDataframeId(fmt::format("{}_{}_{}", timingInfo.runNumber, timingInfo.tfCounter, timingInfo.firstTForbit));
       auto& caches = service->bindingsKeys;
       for (auto i = 0; i < caches.size(); ++i) {
         if (pc.inputs().getPos(caches[i].first.c_str()) >= 0) {
@@ -12,9 +12,16 @@
 #include "Framework/ArrowTableSlicingCache.h"
 #include "Framework/RuntimeError.h"
 
+#include <arrow/builder.h>
 #include <arrow/compute/api_aggregate.h>
 #include <arrow/compute/kernel.h>
 #include <arrow/table.h>
+#include <fmt/format.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <unistd.h>
 
 namespace o2::framework
 {
@@ -79,6 +86,9 @@ ArrowTableSlicingCache::ArrowTableSlicingCache(std::vector<StringPair>&& bsks, s
   : bindingsKeys{bsks},
     bindingsKeysUnsorted{bsksUnsorted}
 {
+  if (auto* dir = getenv("DPL_SLICE_CACHE_DIR")) {
+    persistentCacheDir = dir;
+  }
   values.resize(bindingsKeys.size());
   counts.resize(bindingsKeys.size());
 
@@ -100,6 +110,119 @@ void ArrowTableSlicingCache::setCaches(std::vector<StringPair>&& bsks, std::vect
   groups.resize(bindingsKeysUnsorted.size());
 }
 
+void ArrowTableSlicingCache::setDataframeId(std::string id)
+{
+  dataframeId = std::move(id);
+}
+
+namespace
+{
+// Fingerprint of the key column used to validate persistent entries:
+// number of rows plus first and last value. Cheap to compute and enough
+// to catch a stale or colliding sidecar file.
+struct SliceCacheFingerprint {
+  char magic[4] = {'O', '2', 'S', 'L'};
+  int64_t numRows = 0;
+  int32_t first = 0;
+  int32_t last = 0;
+
+  bool matches(SliceCacheFingerprint const& other) const
+  {
+    // field-by-field: the struct has internal padding which memcmp would
+    // compare (and which is indeterminate)
+    return memcmp(magic, other.magic, sizeof(magic)) == 0 &&
+           numRows == other.numRows && first == other.first && last == other.last;
+  }
+};
+
+SliceCacheFingerprint fingerprintFor(std::shared_ptr<arrow::ChunkedArray> const& column)
+{
+  SliceCacheFingerprint result;
+  // zero the padding bytes as well, so the on-disk representation is
+  // deterministic
+  memset(&result, 0, sizeof(result));
+  memcpy(result.magic, "O2SL", sizeof(result.magic));
+  result.numRows = column->length();
+  auto firstChunk = static_cast<arrow::NumericArray<arrow::Int32Type>>(column->chunk(0)->data());
+  auto lastChunk = static_cast<arrow::NumericArray<arrow::Int32Type>>(column->chunk(column->num_chunks() - 1)->data());
+  result.first = firstChunk.Value(0);
+  result.last = lastChunk.Value(lastChunk.length() - 1);
+  return result;
+}
+} // namespace
+
+std::string ArrowTableSlicingCache::sidecarPathFor(int pos) const
+{
+  return fmt::format("{}/{}_{}_{}.slice", persistentCacheDir, dataframeId, bindingsKeys[pos].first, bindingsKeys[pos].second);
+}
+
+bool ArrowTableSlicingCache::loadCacheEntry(int pos, std::shared_ptr<arrow::Table> const& table)
+{
+  if (persistentCacheDir.empty() || dataframeId.empty()) {
+    return false;
+  }
+  std::ifstream sidecar{sidecarPathFor(pos), std::ios::binary};
+  if (!sidecar.good()) {
+    return false;
+  }
+  SliceCacheFingerprint stored;
+  sidecar.read(reinterpret_cast<char*>(&stored), sizeof(stored));
+  auto current = fingerprintFor(table->GetColumnByName(bindingsKeys[pos].second));
+  if (!sidecar.good() || !stored.matches(current)) {
+    return false;
+  }
+  int64_t n = 0;
+  sidecar.read(reinterpret_cast<char*>(&n), sizeof(n));
+  if (!sidecar.good() || n <= 0 || n > stored.numRows) {
+    return false;
+  }
+  std::vector<int32_t> storedValues(n);
+  std::vector<int64_t> storedCounts(n);
+  sidecar.read(reinterpret_cast<char*>(storedValues.data()), n * sizeof(int32_t));
+  sidecar.read(reinterpret_cast<char*>(storedCounts.data()), n * sizeof(int64_t));
+  if (!sidecar.good()) {
+    return false;
+  }
+  arrow::Int32Builder valuesBuilder;
+  arrow::Int64Builder countsBuilder;
+  std::shared_ptr<arrow::Array> valuesArray;
+  std::shared_ptr<arrow::Array> countsArray;
+  if (!valuesBuilder.AppendValues(storedValues).ok() || !valuesBuilder.Finish(&valuesArray).ok() ||
+      !countsBuilder.AppendValues(storedCounts).ok() || !countsBuilder.Finish(&countsArray).ok()) {
+    return false;
+  }
+  values[pos] = std::static_pointer_cast<arrow::NumericArray<arrow::Int32Type>>(valuesArray);
+  counts[pos] = std::static_pointer_cast<arrow::NumericArray<arrow::Int64Type>>(countsArray);
+  return true;
+}
+
+void ArrowTableSlicingCache::storeCacheEntry(int pos, std::shared_ptr<arrow::Table> const& table)
+{
+  if (persistentCacheDir.empty() || dataframeId.empty()) {
+    return;
+  }
+  // Write to a temporary file and rename, so that concurrent wagons
+  // never observe a partially written entry.
+  auto path = sidecarPathFor(pos);
+  auto tmpPath = fmt::format("{}.{}", path, getpid());
+  std::ofstream sidecar{tmpPath, std::ios::binary | std::ios::trunc};
+  if (!sidecar.good()) {
+    return;
+  }
+  auto fingerprint = fingerprintFor(table->GetColumnByName(bindingsKeys[pos].second));
+  sidecar.write(reinterpret_cast<char const*>(&fingerprint), sizeof(fingerprint));
+  int64_t n = values[pos]->length();
+  sidecar.write(reinterpret_cast<char const*>(&n), sizeof(n));
+  sidecar.write(reinterpret_cast<char const*>(values[pos]->raw_values()), n * sizeof(int32_t));
+  sidecar.write(reinterpret_cast<char const*>(counts[pos]->raw_values()), n * sizeof(int64_t));
+  sidecar.close();
+  if (sidecar.good()) {
+    rename(tmpPath.c_str(), path.c_str());
+  } else {
+    unlink(tmpPath.c_str());
+  }
+}
+
 arrow::Status ArrowTableSlicingCache::updateCacheEntry(int pos, std::shared_ptr<arrow::Table> const& table)
 {
   if (table->num_rows() == 0) {
@@ -107,7 +230,11 @@ arrow::Status ArrowTableSlicingCache::updateCacheEntry(int pos, std::shared_ptr<
     counts[pos].reset();
     return arrow::Status::OK();
   }
+  // diagnose unsorted keys also when the persistent entry hits
   validateOrder(bindingsKeys[pos], table);
+  if (loadCacheEntry(pos, table)) {
+    return arrow::Status::OK();
+  }
   arrow::Datum value_counts;
   auto options = arrow::compute::ScalarAggregateOptions::Defaults();
   ARROW_ASSIGN_OR_RAISE(value_counts,
@@ -118,6 +245,7 @@ arrow::Status ArrowTableSlicingCache::updateCacheEntry(int pos, std::shared_ptr<
   counts[pos].reset();
   values[pos] = std::make_shared<arrow::NumericArray<arrow::Int32Type>>(pair.field(0)->data());
   counts[pos] = std::make_shared<arrow::NumericArray<arrow::Int64Type>>(pair.field(1)->data());
+  storeCacheEntry(pos, table);
   return arrow::Status::OK();
 }
 
@@ -10,6 +10,7 @@
 // or submit itself to any jurisdiction.
 
 #include "Framework/AsyncQueue.h"
+#include <cinttypes>
 #include "Framework/Signpost.h"
 #include "x9.h"
 #include <numeric>
@@ -135,9 +136,19 @@ auto AsyncQueueHelpers::run(AsyncQueue& queue, TimesliceId oldestPossible) -> vo
   }
   O2_SIGNPOST_EVENT_EMIT(async_queue, opid, "run", "Running %zu tasks in iteration %zu", order.size(), queue.iteration);
 
+  // Optional drain budget (DPL_ASYNC_QUEUE_BUDGET): tasks run in priority
+  // order, so with a budget a burst of low-score tasks cannot monopolise
+  // an idle-loop iteration - the surplus stays queued (still coalesced by
+  // the debouncing above) and is drained on the following iterations.
+  static const int64_t drainBudget = getenv("DPL_ASYNC_QUEUE_BUDGET") ? atoll(getenv("DPL_ASYNC_QUEUE_BUDGET")) : -1;
   int runCount = 0;
   for (auto i : order) {
     if (queue.tasks[i].runnable) {
+      if (drainBudget > 0 && runCount >= drainBudget) {
+        O2_SIGNPOST_EVENT_EMIT(async_queue, opid, "run", "Drain budget %" PRIi64 " exhausted, deferring task %d", drainBudget, i);
+        queue.tasks[i].runnable = false; // keep it for the next iteration
+        continue;
+      }
       runCount++;
       // If a task is runable, we can run the task and remove it from the queue
       O2_SIGNPOST_EVENT_EMIT(async_queue, opid, "run", "Running task %{public}s (%d) for timeslice %zu",
@@ -114,6 +114,12 @@ bool ComputingQuotaEvaluator::selectOffer(int task, ComputingQuotaRequest const&
     return enough;
   };
 
+  // Predictive admission (DPL_QUOTA_PREDICTIVE): on top of the explicit
+  // request, require the selected offers to cover the EWMA of the shared
+  // memory consumed per computation, so bursts delay new timeslices
+  // instead of overcommitting the segment and meeting the OOM killer.
+  static const bool predictive = getenv("DPL_QUOTA_PREDICTIVE") && atoi(getenv("DPL_QUOTA_PREDICTIVE"));
+
   bool enough = false;
   int64_t minValidity = 0;
 
@@ -182,6 +188,12 @@ bool ComputingQuotaEvaluator::selectOffer(int task, ComputingQuotaRequest const&
     },
                    minValidity + 100, 0);
   }
+  if (enough && predictive && mShmPerComputationEWMA > 0. && accumulated.sharedMemory > 0 &&
+      double(accumulated.sharedMemory) < mShmPerComputationEWMA) {
+    LOGP(LOGLEVEL, "Predictive admission: selected {} bytes of shm below forecast {:.0f}, delaying computation",
+         accumulated.sharedMemory, mShmPerComputationEWMA);
+    enough = false;
+  }
   // If we get here it means we never got enough offers, so we return false.
   return summarizeWhatHappended(enough, stats.selectedOffers, accumulated, stats);
 }
@@ -192,6 +204,13 @@ void ComputingQuotaEvaluator::consume(int id, ComputingQuotaConsumer& consumer,
   // Notice that actual memory usage might be larger, because we can over
   // allocate.
   consumer(id, mOffers, mStats, reportConsumedOffer);
+  // update the per-computation consumption model for the predictive mode
+  int64_t delta = mStats.totalConsumedBytes - mLastTotalConsumedBytes;
+  mLastTotalConsumedBytes = mStats.totalConsumedBytes;
+  if (delta > 0) {
+    constexpr double alpha = 0.2;
+    mShmPerComputationEWMA = mShmPerComputationEWMA == 0. ? double(delta) : alpha * delta + (1. - alpha) * mShmPerComputationEWMA;
+  }
 }
 
 void ComputingQuotaEvaluator::dispose(int taskId)
@@ -57,14 +57,13 @@ void DPLMonitoringBackend::send(o2::monitoring::Metric const& metric)
   std::array<char, 4096> buffer;
   auto mStream = fmt::format_to(buffer.begin(), "[METRIC] {}", metric.getName());
   for (auto& value : metric.getValues()) {
-    auto stringValue = std::visit(overloaded{
-                                    [](const std::string& value) -> std::string { return value; },
-                                    [](auto value) -> std::string { return std::to_string(value); }},
-                                  value.second);
+    // format the value straight into the buffer: no std::to_string /
+    // temporary string per value, this path runs thousands of times per
+    // second across a big topology
     if (metric.getValuesSize() == 1) {
-      mStream = fmt::format_to(mStream, ",{} {}", metric.getFirstValueType(), stringValue);
+      mStream = std::visit([&](auto const& v) { return fmt::format_to(mStream, ",{} {}", metric.getFirstValueType(), v); }, value.second);
     } else {
-      mStream = fmt::format_to(mStream, " {}={}", value.first, stringValue);
+      mStream = std::visit([&](auto const& v) { return fmt::format_to(mStream, " {}={}", value.first, v); }, value.second);
     }
   }
   // FIXME: tags are ignored by the DPL backend in any case...
@@ -237,65 +237,37 @@ bool DataDescriptorMatcher::match(header::Stack const& stack, VariableContext& c
 // actual polymorphic matcher which is able to cast the pointer to the correct
 // kind of header.
 bool DataDescriptorMatcher::match(char const* d, VariableContext& context) const
+{
+  // Parse the header stack once at the top of the tree: every leaf used
+  // to re-walk the stack via o2::header::get, which dominated the match
+  // cost for deep route expressions.
+  auto dh = o2::header::get<header::DataHeader*>(d);
+  if (dh == nullptr) {
+    throw runtime_error("Cannot find DataHeader");
+  }
+  auto dph = o2::header::get<DataProcessingHeader*>(d);
+  return matchParsed(*dh, dph, context);
+}
+
+bool DataDescriptorMatcher::matchParsed(header::DataHeader const& dh, DataProcessingHeader const* dph, VariableContext& context) const
 {
   bool leftValue = false, rightValue = false;
 
-  // FIXME: Using std::visit is not API compatible due to a new
-  // exception being thrown. This is the ABI compatible version.
-  // Replace with:
-  //
-  // auto eval = [&d](auto&& arg) -> bool {
-  //   using T = std::decay_t<decltype(arg)>;
-  //   if constexpr (std::is_same_v<T, std::unique_ptr<DataDescriptorMatcher>>) {
-  //     return arg->match(d, context);
-  //   if constexpr (std::is_same_v<T, ConstantValueMatcher>) {
-  //     return arg->match(d);
-  //   } else {
-  //     return arg.match(d, context);
-  //   }
-  // };
-  // switch (mOp) {
-  //   case Op::Or:
-  //     return std::visit(eval, mLeft) || std::visit(eval, mRight);
-  //   case Op::And:
-  //     return std::visit(eval, mLeft) && std::visit(eval, mRight);
-  //   case Op::Xor:
-  //     return std::visit(eval, mLeft) ^ std::visit(eval, mRight);
-  //   case Op::Just:
-  //     return std::visit(eval, mLeft);
-  //   case Op::Not:
-  //     return !std::visit(eval, mLeft);
-  // }
-  //  When we drop support for macOS 10.13
   if (auto pval0 = std::get_if<OriginValueMatcher>(&mLeft)) {
-    auto dh = o2::header::get<header::DataHeader*>(d);
-    if (dh == nullptr) {
-      throw runtime_error("Cannot find DataHeader");
-    }
-    leftValue = pval0->match(*dh, context);
+    leftValue = pval0->match(dh, context);
   } else if (auto pval1 = std::get_if<DescriptionValueMatcher>(&mLeft)) {
-    auto dh = o2::header::get<header::DataHeader*>(d);
-    if (dh == nullptr) {
-      throw runtime_error("Cannot find DataHeader");
-    }
-    leftValue = pval1->match(*dh, context);
+    leftValue = pval1->match(dh, context);
   } else if (auto pval2 = std::get_if<SubSpecificationTypeValueMatcher>(&mLeft)) {
-    auto dh = o2::header::get<header::DataHeader*>(d);
-    if (dh == nullptr) {
-      throw runtime_error("Cannot find DataHeader");
-    }
-    leftValue = pval2->match(*dh, context);
+    leftValue = pval2->match(dh, context);
   } else if (auto pval3 = std::get_if<std::unique_ptr<DataDescriptorMatcher>>(&mLeft)) {
-    leftValue = (*pval3)->match(d, context);
+    leftValue = (*pval3)->matchParsed(dh, dph, context);
   } else if (auto pval4 = std::get_if<ConstantValueMatcher>(&mLeft)) {
     leftValue = pval4->match();
   } else if (auto pval5 = std::get_if<StartTimeValueMatcher>(&mLeft)) {
-    auto dh = o2::header::get<header::DataHeader*>(d);
-    auto dph = o2::header::get<DataProcessingHeader*>(d);
     if (dph == nullptr) {
       throw runtime_error("Cannot find DataProcessingHeader");
     }
-    leftValue = pval5->match(*dh, *dph, context);
+    leftValue = pval5->match(dh, *dph, context);
   } else {
     throw runtime_error("Bad parsing tree");
   }
@@ -314,22 +286,20 @@ bool DataDescriptorMatcher::match(char const* d, VariableContext& context) const
   }
 
   if (auto pval0 = std::get_if<OriginValueMatcher>(&mRight)) {
-    auto dh = o2::header::get<header::DataHeader*>(d);
-    rightValue = pval0->match(*dh, context);
+    rightValue = pval0->match(dh, context);
   } else if (auto pval1 = std::get_if<DescriptionValueMatcher>(&mRight)) {
-    auto dh = o2::header::get<header::DataHeader*>(d);
-    rightValue = pval1->match(*dh, context);
+    rightValue = pval1->match(dh, context);
   } else if (auto pval2 = std::get_if<SubSpecificationTypeValueMatcher>(&mRight)) {
-    auto dh = o2::header::get<header::DataHeader*>(d);
-    rightValue = pval2->match(*dh, context);
+    rightValue = pval2->match(dh, context);
   } else if (auto pval3 = std::get_if<std::unique_ptr<DataDescriptorMatcher>>(&mRight)) {
-    rightValue = (*pval3)->match(d, context);
+    rightValue = (*pval3)->matchParsed(dh, dph, context);
   } else if (auto pval4 = std::get_if<ConstantValueMatcher>(&mRight)) {
     rightValue = pval4->match();
   } else if (auto pval5 = std::get_if<StartTimeValueMatcher>(&mRight)) {
-    auto dh = o2::header::get<header::DataHeader*>(d);
-    auto dph = o2::header::get<DataProcessingHeader*>(d);
-    rightValue = pval5->match(*dh, *dph, context);
+    if (dph == nullptr) {
+      throw runtime_error("Cannot find DataProcessingHeader");
+    }
+    rightValue = pval5->match(dh, *dph, context);
   }
   // There are cases in which not having a rightValue might be legitimate,
   // so we do not throw an exception.
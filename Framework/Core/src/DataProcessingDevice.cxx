@@ -38,6 +38,7 @@
 #include "Framework/DriverClient.h"
 #include "Framework/TimesliceIndex.h"
 #include "Framework/VariableContextHelpers.h"
+#include "Framework/WorkStealingHelpers.h"
 #include "Framework/DataProcessingContext.h"
 #include "Framework/DataProcessingHeader.h"
 #include "Framework/DeviceContext.h"
@@ -258,7 +259,13 @@ void run_callback(uv_work_t* handle)
   auto& dataProcessorContext = ref.get<DataProcessorContext>();
   O2_SIGNPOST_ID_FROM_POINTER(sid, device, &dataProcessorContext);
   O2_SIGNPOST_START(device, sid, "run_callback", "Starting run callback on stream %d", task->id.index);
-  DataProcessingDevice::doPrepare(ref);
+  {
+    // Input reception mutates the channels and InputChannelInfo without
+    // any internal locking, so it stays exclusive even when several
+    // streams run; the processing below synchronises via the relayer.
+    std::lock_guard<std::mutex> lock(ref.get<DeviceState>().inputReceiveMutex);
+    DataProcessingDevice::doPrepare(ref);
+  }
   DataProcessingDevice::doRun(ref);
   O2_SIGNPOST_END(device, sid, "run_callback", "Done processing data for stream %d", task->id.index);
 }
@@ -1312,7 +1319,14 @@ void DataProcessingDevice::Run()
 
   bool dplEnableMultithreding = getenv("DPL_THREADPOOL_SIZE") != nullptr;
   if (dplEnableMultithreding) {
-    setenv("UV_THREADPOOL_SIZE", "1", 1);
+    // In work-stealing mode we have as many streams as requested worker
+    // threads, each pulling ready timeslices from the DataRelayer
+    // concurrently.
+    int poolSize = std::max(1, atoi(getenv("DPL_THREADPOOL_SIZE")));
+    setenv("UV_THREADPOOL_SIZE", std::to_string(poolSize).c_str(), 1);
+    mStreams.resize(poolSize);
+    mHandles.resize(poolSize);
+    state.streamPoolSize = poolSize;
   }
 
   while (state.transitionHandling != TransitionHandlingState::Expired) {
@@ -1476,58 +1490,69 @@ void DataProcessingDevice::Run()
     }
 
     assert(mStreams.size() == mHandles.size());
-    /// Decide which task to use
-    TaskStreamRef streamRef{-1};
-    for (size_t ti = 0; ti < mStreams.size(); ti++) {
-      auto& taskInfo = mStreams[ti];
-      if (taskInfo.running) {
-        continue;
+    // In work-stealing mode we keep dispatching until we run out of idle
+    // streams (or of resources), so that every worker can concurrently pull
+    // ready timeslices from the DataRelayer. Without the thread pool we
+    // dispatch at most once, synchronously.
+    bool moreStreamsToDispatch = true;
+    while (moreStreamsToDispatch) {
+      moreStreamsToDispatch = false;
+      /// Decide which task to use
+      TaskStreamRef streamRef{-1};
+      for (size_t ti = 0; ti < mStreams.size(); ti++) {
+        auto& taskInfo = mStreams[ti];
+        if (taskInfo.running) {
+          continue;
+        }
+        // Stream 0 is for when we run in
+        streamRef.index = ti;
       }
-      // Stream 0 is for when we run in
-      streamRef.index = ti;
-    }
-    using o2::monitoring::Metric;
-    using o2::monitoring::Monitoring;
-    using o2::monitoring::tags::Key;
-    using o2::monitoring::tags::Value;
-    // We have an empty stream, let's check if we have enough
-    // resources for it to run something
-    if (streamRef.index != -1) {
-      // Synchronous execution of the callbacks. This will be moved in the
-      // moved in the on_socket_polled once we have threading in place.
-      uv_work_t& handle = mHandles[streamRef.index];
-      TaskStreamInfo& stream = mStreams[streamRef.index];
-      handle.data = &mStreams[streamRef.index];
-
-      static std::function<void(ComputingQuotaOffer const&, ComputingQuotaStats const& stats)> reportExpiredOffer = [&registry = mServiceRegistry](ComputingQuotaOffer const& offer, ComputingQuotaStats const& stats) {
-        ServiceRegistryRef ref{registry};
-        auto& dpStats = ref.get<DataProcessingStats>();
-        dpStats.updateStats({static_cast<short>(ProcessingStatsId::RESOURCE_OFFER_EXPIRED), DataProcessingStats::Op::Set, stats.totalExpiredOffers});
-        dpStats.updateStats({static_cast<short>(ProcessingStatsId::ARROW_BYTES_EXPIRED), DataProcessingStats::Op::Set, stats.totalExpiredBytes});
-        dpStats.processCommandQueue();
-      };
-      auto ref = ServiceRegistryRef{mServiceRegistry};
+      using o2::monitoring::Metric;
+      using o2::monitoring::Monitoring;
+      using o2::monitoring::tags::Key;
+      using o2::monitoring::tags::Value;
+      // We have an empty stream, let's check if we have enough
+      // resources for it to run something
+      if (streamRef.index != -1) {
+        // Synchronous execution of the callbacks. This will be moved in the
+        // moved in the on_socket_polled once we have threading in place.
+        uv_work_t& handle = mHandles[streamRef.index];
+        TaskStreamInfo& stream = mStreams[streamRef.index];
+        handle.data = &mStreams[streamRef.index];
+
+        static std::function<void(ComputingQuotaOffer const&, ComputingQuotaStats const& stats)> reportExpiredOffer = [&registry = mServiceRegistry](ComputingQuotaOffer const& offer, ComputingQuotaStats const& stats) {
+          ServiceRegistryRef ref{registry};
+          auto& dpStats = ref.get<DataProcessingStats>();
+          dpStats.updateStats({static_cast<short>(ProcessingStatsId::RESOURCE_OFFER_EXPIRED), DataProcessingStats::Op::Set, stats.totalExpiredOffers});
+          dpStats.updateStats({static_cast<short>(ProcessingStatsId::ARROW_BYTES_EXPIRED), DataProcessingStats::Op::Set, stats.totalExpiredBytes});
+          dpStats.processCommandQueue();
+        };
+        auto ref = ServiceRegistryRef{mServiceRegistry};
 
-      // Deciding wether to run or not can be done by passing a request to
-      // the evaluator. In this case, the request is always satisfied and
-      // we run on whatever resource is available.
-      auto& spec = ref.get<DeviceSpec const>();
-      bool enough = ref.get<ComputingQuotaEvaluator>().selectOffer(streamRef.index, spec.resourcePolicy.request, uv_now(state.loop));
-
-      if (enough) {
-        stream.id = streamRef;
-        stream.running = true;
-        stream.registry = &mServiceRegistry;
-        if (dplEnableMultithreding) [[unlikely]] {
-          stream.task = &handle;
-          uv_queue_work(state.loop, stream.task, run_callback, run_completion);
+        // Deciding wether to run or not can be done by passing a request to
+        // the evaluator. In this case, the request is always satisfied and
+        // we run on whatever resource is available.
+        auto& spec = ref.get<DeviceSpec const>();
+        bool enough = ref.get<ComputingQuotaEvaluator>().selectOffer(streamRef.index, spec.resourcePolicy.request, uv_now(state.loop));
+
+        if (enough) {
+          stream.id = streamRef;
+          stream.running = true;
+          stream.registry = &mServiceRegistry;
+          if (dplEnableMultithreding) [[unlikely]] {
+            stream.task = &handle;
+            uv_queue_work(state.loop, stream.task, run_callback, run_completion);
+            // Keep the remaining idle streams busy as well, so that they
+            // can steal whatever the first one does not pick up.
+            moreStreamsToDispatch = mStreams.size() > 1;
+          } else {
+            run_callback(&handle);
+            run_completion(&handle, 0);
+          }
         } else {
-          run_callback(&handle);
-          run_completion(&handle, 0);
+          auto ref = ServiceRegistryRef{mServiceRegistry};
+          ref.get<ComputingQuotaEvaluator>().handleExpired(reportExpiredOffer);
         }
-      } else {
-        auto ref = ServiceRegistryRef{mServiceRegistry};
-        ref.get<ComputingQuotaEvaluator>().handleExpired(reportExpiredOffer);
       }
     }
   }
@@ -2405,6 +2430,12 @@ bool DataProcessingDevice::tryDispatchComputation(ServiceRegistryRef ref, std::v
     default:
       break;
   }
+  // In work-stealing mode each stream processes the timeslices with
+  // affinity to it first and steals whatever is left, so that a given
+  // timeslice tends to stay on the same core across iterations.
+  if (state.streamPoolSize > 1) {
+    WorkStealingHelpers::prioritiseOwnTimeslices(completed, std::max<short>(0, ref.streamId() - 1), state.streamPoolSize);
+  }
 
   for (auto action : completed) {
     O2_SIGNPOST_ID_GENERATE(aid, device);
@@ -10,6 +10,9 @@
 // or submit itself to any jurisdiction.
 
 #include "Framework/DataProcessingStates.h"
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
 #include "Framework/RuntimeError.h"
 #include "Framework/ServiceRegistryRef.h"
 #include "Framework/DeviceState.h"
@@ -90,9 +93,82 @@ void DataProcessingStates::processCommandQueue()
   generation++;
 }
 
+namespace
+{
+/// Always-on flight recorder (DPL_FLIGHT_RECORDER=<dir>): every state
+/// transition is appended to a small memory-mapped per-process ring, so
+/// the last transitions survive a crash or stall and can be read out of
+/// the file post mortem instead of being reconstructed from logs. One
+/// cache line per record; the write index lives in the mapped header so
+/// readers can locate the tail.
+struct FlightRecorderRing {
+  struct Record {
+    int64_t timestamp = 0;
+    int32_t id = 0;
+    char value[48] = {};
+  };
+  struct Header {
+    uint64_t magic = 0x4f32464c54524543ull; // "O2FLTREC"
+    uint64_t nRecords = 0;
+    std::atomic<uint64_t> writeIndex{0};
+  };
+  Header* header = nullptr;
+  Record* records = nullptr;
+  size_t nRecords = 0;
+
+  static FlightRecorderRing& instance()
+  {
+    static FlightRecorderRing ring = []() {
+      FlightRecorderRing r;
+      const char* dir = getenv("DPL_FLIGHT_RECORDER");
+      if (!dir) {
+        return r;
+      }
+      constexpr size_t N = 4096;
+      size_t total = sizeof(Header) + N * sizeof(Record);
+      auto path = std::string(dir) + "/dpl-flight-" + std::to_string(getpid()) + ".ring";
+      int fd = open(path.c_str(), O_CREAT | O_RDWR, 0644);
+      if (fd < 0) {
+        return r;
+      }
+      if (ftruncate(fd, total) != 0) {
+        close(fd);
+        return r;
+      }
+      void* mem = mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+      close(fd);
+      if (mem == MAP_FAILED) {
+        return r;
+      }
+      r.header = new (mem) Header();
+      r.header->nRecords = N;
+      r.records = reinterpret_cast<Record*>(static_cast<char*>(mem) + sizeof(Header));
+      r.nRecords = N;
+      return r;
+    }();
+    return ring;
+  }
+
+  void append(int64_t timestamp, int id, const char* data, int size)
+  {
+    if (!header) {
+      return;
+    }
+    auto slot = header->writeIndex.fetch_add(1, std::memory_order_relaxed) % nRecords;
+    auto& rec = records[slot];
+    rec.timestamp = timestamp;
+    rec.id = id;
+    int n = size < (int)sizeof(rec.value) - 1 ? size : (int)sizeof(rec.value) - 1;
+    memcpy(rec.value, data, n);
+    rec.value[n] = 0;
+  }
+};
+} // namespace
+
 void DataProcessingStates::updateState(CommandSpec cmd)
 {
   LOGP(debug, "Updating state {} with {}", cmd.id, std::string_view(cmd.data, cmd.size));
+  FlightRecorderRing::instance().append(getTimestamp(realTimeBase, initialTimeOffset), cmd.id, cmd.data, cmd.size);
   if (stateSpecs[cmd.id].name.empty()) {
     throw runtime_error_f("StateID %d was not registered", (int)cmd.id);
   }
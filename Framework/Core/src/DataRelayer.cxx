@@ -112,6 +112,7 @@ DataRelayer::ActivityStats DataRelayer::processDanglingInputs(std::vector<Expira
 {
   LOGP(debug, "DataRelayer::processDanglingInputs");
   std::scoped_lock<O2_LOCKABLE(std::recursive_mutex)> lock(mMutex);
+  mMutationGeneration.fetch_add(1, std::memory_order_release);
   auto& deviceProxy = services.get<FairMQDeviceProxy>();
 
   ActivityStats activity;
@@ -283,6 +284,7 @@ void sendVariableContextMetrics(VariableContext& context, TimesliceSlot slot, Da
 
 void DataRelayer::setOldestPossibleInput(TimesliceId proposed, ChannelIndex channel)
 {
+  mMutationGeneration.fetch_add(1, std::memory_order_release);
   auto newOldest = mTimesliceIndex.setOldestPossibleInput(proposed, channel);
   LOGP(debug, "DataRelayer::setOldestPossibleInput {} from channel {}", newOldest.timeslice.value, newOldest.channel.value);
   static bool dontDrop = getenv("DPL_DONT_DROP_OLD_TIMESLICE") && atoi(getenv("DPL_DONT_DROP_OLD_TIMESLICE"));
@@ -358,12 +360,14 @@ void DataRelayer::prunePending(OnDropCallback onDrop)
 
 void DataRelayer::pruneCache(TimesliceSlot slot, OnDropCallback onDrop)
 {
+  mMutationGeneration.fetch_add(1, std::memory_order_release);
   // We need to prune the cache from the old stuff, if any. Otherwise we
   // simply store the payload in the cache and we mark relevant bit in the
   // hence the first if.
   auto pruneCache = [&onDrop,
                      &cache = mCache,
                      &cachedStateMetrics = mCachedStateMetrics,
+                     &droppedPerRoute = mDroppedPerRoute,
                      numInputTypes = mDistinctRoutesIndex.size(),
                      &index = mTimesliceIndex,
                      ref = mContext](TimesliceSlot slot) {
@@ -371,12 +375,14 @@ void DataRelayer::pruneCache(TimesliceSlot slot, OnDropCallback onDrop)
       auto oldestPossibleTimeslice = index.getOldestPossibleOutput();
       // State of the computation
       std::vector<MessageSet> dropped(numInputTypes);
+      droppedPerRoute.resize(numInputTypes, 0);
       for (size_t ai = 0, ae = numInputTypes; ai != ae; ++ai) {
         auto cacheId = slot.index * numInputTypes + ai;
         cachedStateMetrics[cacheId] = CacheEntryStatus::RUNNING;
         // TODO: in the original implementation of the cache, there have been only two messages per entry,
         // check if the 2 above corresponds to the number of messages.
         if (cache[cacheId].size() > 0) {
+          droppedPerRoute[ai] += cache[cacheId].size();
           dropped[ai] = std::move(cache[cacheId]);
         }
       }
@@ -417,6 +423,7 @@ DataRelayer::RelayChoice
                      std::function<void(TimesliceSlot, std::vector<MessageSet>&, TimesliceIndex::OldestOutputInfo)> onDrop)
 {
   std::scoped_lock<O2_LOCKABLE(std::recursive_mutex)> lock(mMutex);
+  mMutationGeneration.fetch_add(1, std::memory_order_release);
   DataProcessingHeader const* dph = o2::header::get<DataProcessingHeader*>(rawHeader);
   // IMPLEMENTATION DETAILS
   //
@@ -665,6 +672,15 @@ DataRelayer::RelayChoice
 void DataRelayer::getReadyToProcess(std::vector<DataRelayer::RecordAction>& completed)
 {
   LOGP(debug, "DataRelayer::getReadyToProcess");
+  // Lock-free fast path: if nothing mutated the relayer since the end of
+  // the last scan, no slot is dirty and the last scan did not leave Retry
+  // slots behind, the completion decisions cannot have changed, so we
+  // avoid serialising all the polling streams on mMutex.
+  if (mLastScanSawRetry.load(std::memory_order_acquire) == false &&
+      mTimesliceIndex.dirtySlotCount() == 0 &&
+      mMutationGeneration.load(std::memory_order_acquire) == mLastScanGeneration.load(std::memory_order_acquire)) {
+    return;
+  }
   std::scoped_lock<O2_LOCKABLE(std::recursive_mutex)> lock(mMutex);
 
   // THE STATE
@@ -717,6 +733,7 @@ void DataRelayer::getReadyToProcess(std::vector<DataRelayer::RecordAction>& comp
   int countProcess = 0;
   int countDiscard = 0;
   int countWait = 0;
+  int countRetry = 0;
   int notDirty = 0;
 
   for (int li = cacheLines - 1; li >= 0; --li) {
@@ -781,6 +798,7 @@ void DataRelayer::getReadyToProcess(std::vector<DataRelayer::RecordAction>& comp
         break;
       case CompletionPolicy::CompletionOp::Retry:
         countWait++;
+        countRetry++;
         mTimesliceIndex.markAsDirty(slot, true);
         action = CompletionPolicy::CompletionOp::Wait;
         break;
@@ -791,6 +809,8 @@ void DataRelayer::getReadyToProcess(std::vector<DataRelayer::RecordAction>& comp
     }
   }
   mTimesliceIndex.updateOldestPossibleOutput(false);
+  mLastScanSawRetry.store(countRetry != 0, std::memory_order_release);
+  mLastScanGeneration.store(mMutationGeneration.load(std::memory_order_relaxed), std::memory_order_release);
   LOGP(debug, "DataRelayer::getReadyToProcess results notDirty:{}, consume:{}, consumeExisting:{}, process:{}, discard:{}, wait:{}",
        notDirty, countConsume, countConsumeExisting, countProcess,
        countDiscard, countWait);
@@ -799,6 +819,7 @@ void DataRelayer::getReadyToProcess(std::vector<DataRelayer::RecordAction>& comp
 void DataRelayer::updateCacheStatus(TimesliceSlot slot, CacheEntryStatus oldStatus, CacheEntryStatus newStatus)
 {
   std::scoped_lock<O2_LOCKABLE(std::recursive_mutex)> lock(mMutex);
+  mMutationGeneration.fetch_add(1, std::memory_order_release);
   const auto numInputTypes = mDistinctRoutesIndex.size();
 
   auto markInputDone = [&cachedStateMetrics = mCachedStateMetrics,
@@ -817,6 +838,7 @@ void DataRelayer::updateCacheStatus(TimesliceSlot slot, CacheEntryStatus oldStat
 std::vector<o2::framework::MessageSet> DataRelayer::consumeAllInputsForTimeslice(TimesliceSlot slot)
 {
   std::scoped_lock<O2_LOCKABLE(std::recursive_mutex)> lock(mMutex);
+  mMutationGeneration.fetch_add(1, std::memory_order_release);
 
   const auto numInputTypes = mDistinctRoutesIndex.size();
   // State of the computation
@@ -871,6 +893,7 @@ std::vector<o2::framework::MessageSet> DataRelayer::consumeAllInputsForTimeslice
 std::vector<o2::framework::MessageSet> DataRelayer::consumeExistingInputsForTimeslice(TimesliceSlot slot)
 {
   std::scoped_lock<O2_LOCKABLE(std::recursive_mutex)> lock(mMutex);
+  mMutationGeneration.fetch_add(1, std::memory_order_release);
 
   const auto numInputTypes = mDistinctRoutesIndex.size();
   // State of the computation
@@ -914,6 +937,7 @@ std::vector<o2::framework::MessageSet> DataRelayer::consumeExistingInputsForTime
 void DataRelayer::clear()
 {
   std::scoped_lock<O2_LOCKABLE(std::recursive_mutex)> lock(mMutex);
+  mMutationGeneration.fetch_add(1, std::memory_order_release);
 
   for (auto& cache : mCache) {
     cache.clear();
@@ -936,6 +960,7 @@ size_t
 void DataRelayer::setPipelineLength(size_t s)
 {
   std::scoped_lock<O2_LOCKABLE(std::recursive_mutex)> lock(mMutex);
+  mMutationGeneration.fetch_add(1, std::memory_order_release);
 
   mTimesliceIndex.resize(s);
   mVariableContextes.resize(s);
@@ -16,7 +16,9 @@
 #include "gandiva/tree_expr_builder.h"
 #include <algorithm>
 #include <iostream>
+#include <mutex>
 #include <set>
+#include <unordered_map>
 #include <stack>
 #include <unordered_map>
 
@@ -440,30 +442,45 @@ gandiva::ExpressionPtr makeExpression(gandiva::NodePtr node, gandiva::FieldPtr r
   return gandiva::TreeExprBuilder::MakeExpression(std::move(node), std::move(result));
 }
 
-std::shared_ptr<gandiva::Filter>
-  createFilter(gandiva::SchemaPtr const& Schema, Operations const& opSpecs)
+namespace
+{
+/// Process-local memoization of compiled gandiva kernels: trains attach
+/// many tasks with identical selections to the same process, and each
+/// JIT compilation costs LLVM time at startup. Keyed by the string
+/// representation of the condition and the schema.
+std::shared_ptr<gandiva::Filter> makeFilterCached(gandiva::SchemaPtr const& schema, gandiva::ConditionPtr condition)
 {
+  static std::mutex cacheMutex;
+  static std::unordered_map<std::string, std::shared_ptr<gandiva::Filter>> cache;
+  auto key = condition->ToString() + "|" + schema->ToString();
+  {
+    std::lock_guard<std::mutex> lock{cacheMutex};
+    auto cached = cache.find(key);
+    if (cached != cache.end()) {
+      return cached->second;
+    }
+  }
   std::shared_ptr<gandiva::Filter> filter;
-  auto s = gandiva::Filter::Make(Schema,
-                                 makeCondition(createExpressionTree(opSpecs, Schema)),
-                                 &filter);
+  auto s = gandiva::Filter::Make(schema, std::move(condition), &filter);
   if (!s.ok()) {
     throw runtime_error_f("Failed to create filter: %s", s.ToString().c_str());
   }
+  std::lock_guard<std::mutex> lock{cacheMutex};
+  cache.emplace(std::move(key), filter);
   return filter;
 }
+} // namespace
+
+std::shared_ptr<gandiva::Filter>
+  createFilter(gandiva::SchemaPtr const& Schema, Operations const& opSpecs)
+{
+  return makeFilterCached(Schema, makeCondition(createExpressionTree(opSpecs, Schema)));
+}
 
 std::shared_ptr<gandiva::Filter>
   createFilter(gandiva::SchemaPtr const& Schema, gandiva::ConditionPtr condition)
 {
-  std::shared_ptr<gandiva::Filter> filter;
-  auto s = gandiva::Filter::Make(Schema,
-                                 std::move(condition),
-                                 &filter);
-  if (!s.ok()) {
-    throw runtime_error_f("Failed to create filter: %s", s.ToString().c_str());
-  }
-  return filter;
+  return makeFilterCached(Schema, std::move(condition));
 }
 
 std::shared_ptr<gandiva::Projector>
@@ -45,6 +45,9 @@
 #include <cassert>
 #include <memory>
 #include <optional>
+#include <cstring>
+#include <map>
+#include <tuple>
 #include <unordered_map>
 #include <numeric> // std::accumulate
 #include <sstream>
@@ -475,6 +478,10 @@ InjectorFunction dplModelAdaptor(std::vector<OutputSpec> const& filterSpecs, DPL
     // FIXME: this in not thread safe, but better than an alloc of a map per message...
     std::unordered_map<std::string, fair::mq::Parts> outputs;
     std::vector<std::string> unmatchedDescriptions;
+    // Channel resolution cache for this timeslice: a TF carries many parts
+    // of the same concrete spec, and with the payload handles just moved
+    // the repeated string-based filter matching is what costs proxy CPU.
+    std::map<std::tuple<uint64_t, uint64_t, uint64_t>, std::string> channelCache;
     auto* device = services.get<RawDeviceService>().device();
 
     static bool override_creation_env = getenv("DPL_RAWPROXY_OVERRIDE_ORBITRESET");
@@ -527,17 +534,26 @@ InjectorFunction dplModelAdaptor(std::vector<OutputSpec> const& filterSpecs, DPL
       int finalBlockIndex = 0;
       std::string channelName = "";
 
-      for (auto const& spec : filterSpecs) {
-        // filter on the specified OutputSpecs, the default value is a ConcreteDataTypeMatcher with origin and description 'any'
-        if (DataSpecUtils::match(spec, OutputSpec{{header::gDataOriginAny, header::gDataDescriptionAny}}) ||
-            DataSpecUtils::match(spec, query)) {
-          channelName = channelRetriever(query, dph->startTime);
-          // We do not complain about DPL/EOS/0, since it's normal not to forward it.
-          if (channelName.empty() && DataSpecUtils::describe(query) != "DPL/EOS/0") {
-            LOG(warning) << "can not find matching channel, not able to adopt " << DataSpecUtils::describe(query);
+      std::tuple<uint64_t, uint64_t, uint64_t> specKey{0, 0, uint64_t(dh->subSpecification)};
+      memcpy(&std::get<0>(specKey), dh->dataDescription.str, sizeof(uint64_t));
+      memcpy(&std::get<1>(specKey), dh->dataDescription.str + sizeof(uint64_t), sizeof(uint64_t));
+      memcpy(reinterpret_cast<char*>(&std::get<2>(specKey)) + sizeof(uint32_t), dh->dataOrigin.str, sizeof(uint32_t));
+      if (auto cached = channelCache.find(specKey); cached != channelCache.end()) {
+        channelName = cached->second;
+      } else {
+        for (auto const& spec : filterSpecs) {
+          // filter on the specified OutputSpecs, the default value is a ConcreteDataTypeMatcher with origin and description 'any'
+          if (DataSpecUtils::match(spec, OutputSpec{{header::gDataOriginAny, header::gDataDescriptionAny}}) ||
+              DataSpecUtils::match(spec, query)) {
+            channelName = channelRetriever(query, dph->startTime);
+            // We do not complain about DPL/EOS/0, since it's normal not to forward it.
+            if (channelName.empty() && DataSpecUtils::describe(query) != "DPL/EOS/0") {
+              LOG(warning) << "can not find matching channel, not able to adopt " << DataSpecUtils::describe(query);
+            }
+            break;
           }
-          break;
         }
+        channelCache.emplace(specKey, channelName);
       }
       finalBlockIndex = getFinalIndex(*dh, msgidx);
       if (finalBlockIndex > parts.Size()) {
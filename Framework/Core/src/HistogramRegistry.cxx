@@ -187,6 +187,14 @@ double HistogramRegistry::getSize(double fillFraction)
   return size;
 }
 
+void HistogramRegistry::setConcurrentFillMode(bool enable)
+{
+  if (enable && !mFillLocks) {
+    mFillLocks = std::make_unique<FillLock[]>(MAX_REGISTRY_SIZE);
+  }
+  mConcurrentFill = enable;
+}
+
 void HistogramRegistry::clean()
 {
   for (auto& value : mRegistryValue) {
@@ -13,13 +13,49 @@
 #include "Framework/MessageContext.h"
 #include "Framework/OutputRoute.h"
 #include <fairmq/Device.h>
+#include <cstdlib>
 
 namespace o2::framework
 {
 
+// On size-class freelists: the arena below supersedes them for the small
+// message case - a bump carve has no per-size bookkeeping and returns
+// space wholesale, while FairMQ messages themselves cannot be recycled
+// across sends (ownership passes to the transport on Send and the ack
+// only returns the region space, which is exactly what the arena
+// tracks via its region callback).
+fair::mq::MessagePtr MessageContext::tryAllocateFromArena(fair::mq::TransportFactory* transport, size_t size)
+{
+  static long arenaSizeMB = getenv("DPL_MESSAGE_ARENA_SIZE") ? atol(getenv("DPL_MESSAGE_ARENA_SIZE")) : 0;
+  if (arenaSizeMB <= 0 || size > ArenaSmallMessageLimit) {
+    return nullptr;
+  }
+  auto& arena = mArenas[transport];
+  if (arena.region == nullptr) {
+    // the callback only touches the shared counter, so it is safe to run
+    // on the transport thread and to outlive this context
+    auto counter = arena.inFlight;
+    arena.region = transport->CreateUnmanagedRegion(arenaSizeMB * 1024 * 1024,
+                                                    [counter](void*, size_t, void*) { counter->fetch_sub(1, std::memory_order_release); });
+    arena.data = static_cast<char*>(arena.region->GetData());
+    arena.size = arena.region->GetSize();
+  }
+  constexpr size_t Alignment = 64;
+  size_t aligned = (arena.offset + Alignment - 1) & ~(Alignment - 1);
+  if (aligned + size > arena.size) {
+    return nullptr; // exhausted, fall back to the segment allocator
+  }
+  arena.offset = aligned + size;
+  arena.inFlight->fetch_add(1, std::memory_order_relaxed);
+  return transport->CreateMessage(arena.region, arena.data + aligned, size);
+}
+
 fair::mq::MessagePtr MessageContext::createMessage(RouteIndex routeIndex, int index, size_t size)
 {
   auto* transport = mProxy.getOutputTransport(routeIndex);
+  if (auto msg = tryAllocateFromArena(transport, size)) {
+    return msg;
+  }
   return transport->CreateMessage(size, fair::mq::Alignment{64});
 }
 
@@ -105,6 +141,13 @@ void MessageContext::clear()
   assert(std::all_of(mMessages.begin(), mMessages.end(), [](auto& m) { return m->empty(); }));
   mDidDispatch = false;
   mMessages.clear();
+  // Reclaim the bump arenas wholesale once the transport released all the
+  // messages carved from them.
+  for (auto& [transport, arena] : mArenas) {
+    if (arena.offset != 0 && arena.inFlight->load(std::memory_order_acquire) == 0) {
+      arena.offset = 0;
+    }
+  }
 }
 
 int64_t MessageContext::addToCache(std::unique_ptr<fair::mq::Message>& toCache)
@@ -10,6 +10,9 @@
 // or submit itself to any jurisdiction.
 
 #include "Framework/RateLimiter.h"
+#include <atomic>
+#include <fcntl.h>
+#include <sys/mman.h>
 #include "Framework/RawDeviceService.h"
 #include "Framework/ServiceRegistry.h"
 #include "Framework/RunningWorkflowInfo.h"
@@ -25,11 +28,62 @@
 
 using namespace o2::framework;
 
+namespace
+{
+// Node-scoped TF-in-flight token counter, shared by all drivers on the
+// host via a small shm segment (opt-in through DPL_NODE_MAX_TF_INFLIGHT,
+// segment name overridable with DPL_NODE_TOKEN_NAME). Tokens are
+// returned on the consumption feedback; a crashed workflow leaves its
+// tokens taken, so the segment should be removed between runs by the
+// node controller.
+std::atomic<int64_t>* nodeInFlightCounter()
+{
+  static std::atomic<int64_t>* counter = []() -> std::atomic<int64_t>* {
+    const char* limit = getenv("DPL_NODE_MAX_TF_INFLIGHT");
+    if (!limit || atoll(limit) <= 0) {
+      return nullptr;
+    }
+    const char* name = getenv("DPL_NODE_TOKEN_NAME");
+    std::string shmName = name ? name : "/o2_dpl_node_tf_tokens";
+    int fd = shm_open(shmName.c_str(), O_CREAT | O_RDWR, 0666);
+    if (fd < 0) {
+      return nullptr;
+    }
+    ftruncate(fd, sizeof(std::atomic<int64_t>));
+    void* mem = mmap(nullptr, sizeof(std::atomic<int64_t>), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mem == MAP_FAILED) {
+      return nullptr;
+    }
+    return reinterpret_cast<std::atomic<int64_t>*>(mem);
+  }();
+  return counter;
+}
+
+int64_t nodeMaxInFlight()
+{
+  static const int64_t max = getenv("DPL_NODE_MAX_TF_INFLIGHT") ? atoll(getenv("DPL_NODE_MAX_TF_INFLIGHT")) : 0;
+  return max;
+}
+} // namespace
+
 int RateLimiter::check(ProcessingContext& ctx, int maxInFlight, size_t minSHM)
 {
   if (!maxInFlight && !minSHM) {
     return 0;
   }
+  if (auto* nodeCounter = nodeInFlightCounter()) {
+    // coordinate with the other workflows of the node before the
+    // per-workflow limits below
+    bool reported = false;
+    while (nodeCounter->load(std::memory_order_acquire) >= nodeMaxInFlight()) {
+      if (!reported) {
+        LOG(info) << "Node-level TF in flight limit (" << nodeMaxInFlight() << ") reached, waiting";
+        reported = true;
+      }
+      usleep(30000);
+    }
+  }
   auto device = ctx.services().get<RawDeviceService>().device();
   auto& deviceState = ctx.services().get<DeviceState>();
   if (maxInFlight && device->GetChannels().count("metric-feedback")) {
@@ -66,7 +120,11 @@ int RateLimiter::check(ProcessingContext& ctx, int maxInFlight, size_t minSHM)
         continue;
       }
       assert(msg->GetSize() == 8);
+      auto consumedBefore = mConsumedTimeframes;
       mConsumedTimeframes = *(int64_t*)msg->GetData();
+      if (auto* nodeCounter = nodeInFlightCounter(); nodeCounter && mConsumedTimeframes > consumedBefore) {
+        nodeCounter->fetch_sub(mConsumedTimeframes - consumedBefore, std::memory_order_release);
+      }
     }
     if (waitMessage) {
       if (dtc.deploymentMode == DeploymentMode::OnlineDDS || dtc.deploymentMode == DeploymentMode::OnlineECS || dtc.deploymentMode == DeploymentMode::FST) {
@@ -161,6 +219,9 @@ int RateLimiter::check(ProcessingContext& ctx, int maxInFlight, size_t minSHM)
       usleep(30000);
     }
   }
+  if (auto* nodeCounter = nodeInFlightCounter()) {
+    nodeCounter->fetch_add(1, std::memory_order_release);
+  }
   mSentTimeframes++;
   return 0;
 }
@@ -10,6 +10,7 @@
 // or submit itself to any jurisdiction.
 
 #include "Framework/TableBuilder.h"
+#include <thread>
 #include <memory>
 #if defined(__GNUC__)
 #pragma GCC diagnostic push
@@ -91,11 +92,7 @@ std::shared_ptr<arrow::Table> spawnerHelper(std::shared_ptr<arrow::Table>& fullT
 
   arrow::TableBatchReader reader(*fullTable);
   std::shared_ptr<arrow::RecordBatch> batch;
-  arrow::ArrayVector v;
-  std::vector<arrow::ArrayVector> chunks;
-  chunks.resize(nColumns);
-  std::vector<std::shared_ptr<arrow::ChunkedArray>> arrays;
-
+  std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
   while (true) {
     auto s = reader.ReadNext(&batch);
     if (!s.ok()) {
@@ -104,15 +101,61 @@ std::shared_ptr<arrow::Table> spawnerHelper(std::shared_ptr<arrow::Table>& fullT
     if (batch == nullptr) {
       break;
     }
-    try {
-      s = mergedProjectors->Evaluate(*batch, arrow::default_memory_pool(), &v);
-      if (!s.ok()) {
-        throw runtime_error_f("Cannot apply projector to source table of %s: %s", name, s.ToString().c_str());
+    batches.push_back(batch);
+  }
+
+  std::vector<arrow::ArrayVector> results(batches.size());
+  // Chunk-parallel materialization (O2_SPAWNER_THREADS): gandiva
+  // projectors are thread safe for evaluation, the batches are
+  // independent and the outputs are assembled in batch order, so the
+  // resulting table is identical to the serial evaluation.
+  // re-read per spawn (cheap next to the projector evaluation), so the
+  // setting can be toggled by tests and per-stage configuration
+  const int nSpawnThreads = getenv("O2_SPAWNER_THREADS") ? atoi(getenv("O2_SPAWNER_THREADS")) : 1;
+  auto evaluateRange = [&](size_t begin, size_t end) {
+    for (size_t bi = begin; bi < end; ++bi) {
+      try {
+        auto s = mergedProjectors->Evaluate(*batches[bi], arrow::default_memory_pool(), &results[bi]);
+        if (!s.ok()) {
+          throw runtime_error_f("Cannot apply projector to source table of %s: %s", name, s.ToString().c_str());
+        }
+      } catch (std::exception& e) {
+        throw runtime_error_f("Cannot apply projector to source table of %s: exception caught: %s", name, e.what());
+      }
+    }
+  };
+  if (nSpawnThreads > 1 && batches.size() > 1) {
+    size_t nWorkers = std::min<size_t>(nSpawnThreads, batches.size());
+    std::vector<std::thread> workers;
+    std::vector<std::exception_ptr> errors(nWorkers);
+    size_t perWorker = (batches.size() + nWorkers - 1) / nWorkers;
+    for (size_t w = 0; w < nWorkers; ++w) {
+      size_t begin = w * perWorker;
+      size_t end = std::min(batches.size(), begin + perWorker);
+      workers.emplace_back([&, w, begin, end]() {
+        try {
+          evaluateRange(begin, end);
+        } catch (...) {
+          errors[w] = std::current_exception();
+        }
+      });
+    }
+    for (auto& worker : workers) {
+      worker.join();
+    }
+    for (auto& error : errors) {
+      if (error) {
+        std::rethrow_exception(error);
       }
-    } catch (std::exception& e) {
-      throw runtime_error_f("Cannot apply projector to source table of %s: exception caught: %s", name, e.what());
     }
+  } else {
+    evaluateRange(0, batches.size());
+  }
 
+  std::vector<arrow::ArrayVector> chunks;
+  chunks.resize(nColumns);
+  std::vector<std::shared_ptr<arrow::ChunkedArray>> arrays;
+  for (auto& v : results) {
     for (auto i = 0U; i < nColumns; ++i) {
       chunks[i].emplace_back(v.at(i));
     }
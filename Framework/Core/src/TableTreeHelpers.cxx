@@ -530,7 +530,13 @@ void TreeToTable::fill(TTree*)
 {
   std::vector<std::shared_ptr<arrow::ChunkedArray>> columns;
   std::vector<std::shared_ptr<arrow::Field>> fields;
-  static TBufferFile buffer{TBuffer::EMode::kWrite, 4 * 1024 * 1024};
+  // thread_local rather than static: several TreeToTable instances may
+  // run on different threads (e.g. parallel table conversions), and the
+  // shared scratch buffer would be a silent data race. Branches of one
+  // tree still have to be read serially - TTree/TFile access itself is
+  // not thread safe - so intra-tree parallelism has to come from
+  // converting different trees concurrently.
+  static thread_local TBufferFile buffer{TBuffer::EMode::kWrite, 4 * 1024 * 1024};
   for (auto& reader : mBranchReaders) {
     buffer.Reset();
     auto arrayAndField = reader->read(&buffer);
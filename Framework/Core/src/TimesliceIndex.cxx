@@ -28,6 +28,7 @@ void TimesliceIndex::resize(size_t s)
   mVariables.resize(s);
   mPublishedVariables.resize(s);
   mDirty.resize(s, false);
+  mDirtyCount.store((int32_t)std::count(mDirty.begin(), mDirty.end(), true), std::memory_order_release);
 }
 
 void TimesliceIndex::associate(TimesliceId timestamp, TimesliceSlot slot)
@@ -35,7 +36,7 @@ void TimesliceIndex::associate(TimesliceId timestamp, TimesliceSlot slot)
   assert(mVariables.size() > slot.index);
   mVariables[slot.index].put({0, static_cast<uint64_t>(timestamp.value)});
   mVariables[slot.index].commit();
-  mDirty[slot.index] = true;
+  markAsDirty(slot, true);
   O2_SIGNPOST_ID_GENERATE(tid, timeslice_index);
   O2_SIGNPOST_EVENT_EMIT(timeslice_index, tid, "associate", "Associating timestamp %zu to slot %zu", timestamp.value, slot.index);
 }
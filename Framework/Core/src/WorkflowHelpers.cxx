@@ -36,6 +36,10 @@
 #include <utility>
 #include <vector>
 #include <climits>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <unistd.h>
 
 O2_DECLARE_DYNAMIC_LOG(workflow_helpers);
 
@@ -812,6 +816,76 @@ void WorkflowHelpers::constructGraph(const WorkflowSpec& workflow,
   // parallel pipeline and add an edge for each.
   enumerateAvailableOutputs();
 
+  // Cross-invocation topology cache (opt-in via DPL_TOPOLOGY_CACHE_DIR):
+  // the input/output matching below evaluates every input spec against
+  // every output of the workflow and is recomputed identically on each
+  // start of the same pipeline. Its products - the logical edges and the
+  // forward info, both plain index tuples - are keyed by a hash of the
+  // workflow structure (processor names, pipelining factors and the full
+  // description of every input and output spec) and replayed on the next
+  // invocation. The device specs themselves own the process' lambdas and
+  // are rebuilt as usual, only the quadratic matching is skipped.
+  static const char* topologyCacheDir = getenv("DPL_TOPOLOGY_CACHE_DIR");
+  std::string topologyCachePath;
+  if (topologyCacheDir) {
+    uint64_t structureHash = 0xcbf29ce484222325;
+    auto update = [&structureHash](std::string const& part) {
+      for (char c : part) {
+        structureHash = (structureHash ^ uint8_t(c)) * 0x100000001b3;
+      }
+      structureHash = (structureHash ^ 0xffu) * 0x100000001b3; // separator
+    };
+    for (auto& processor : workflow) {
+      update(processor.name);
+      update(std::to_string(processor.maxInputTimeslices));
+      for (auto& input : processor.inputs) {
+        update(DataSpecUtils::describe(input));
+      }
+      for (auto& output : processor.outputs) {
+        update(DataSpecUtils::describe(output));
+      }
+    }
+    topologyCachePath = fmt::format("{}/dpl_topology_{:016x}.bin", topologyCacheDir, structureHash);
+    std::ifstream cacheIn(topologyCachePath, std::ios::binary);
+    char magic[8] = {0};
+    uint64_t nEdges = 0, nForwards = 0;
+    cacheIn.read(magic, sizeof(magic));
+    cacheIn.read(reinterpret_cast<char*>(&nEdges), sizeof(nEdges));
+    cacheIn.read(reinterpret_cast<char*>(&nForwards), sizeof(nForwards));
+    if (cacheIn.good() && memcmp(magic, "O2DPLTG1", 8) == 0) {
+      std::vector<DeviceConnectionEdge> cachedEdges(nEdges);
+      std::vector<LogicalForwardInfo> cachedForwards(nForwards);
+      cacheIn.read(reinterpret_cast<char*>(cachedEdges.data()), nEdges * sizeof(DeviceConnectionEdge));
+      cacheIn.read(reinterpret_cast<char*>(cachedForwards.data()), nForwards * sizeof(LogicalForwardInfo));
+      bool consistent = cacheIn.good();
+      for (auto& edge : cachedEdges) {
+        if (edge.producer >= workflow.size() || edge.consumer >= workflow.size() ||
+            edge.outputGlobalIndex >= constOutputs.size() ||
+            edge.consumerInputIndex >= workflow[edge.consumer].inputs.size() ||
+            edge.timeIndex >= workflow[edge.consumer].maxInputTimeslices ||
+            edge.producerTimeIndex >= workflow[edge.producer].maxInputTimeslices) {
+          consistent = false;
+          break;
+        }
+      }
+      for (auto& forward : cachedForwards) {
+        if (forward.consumer >= workflow.size() ||
+            forward.inputLocalIndex >= workflow[forward.consumer].inputs.size() ||
+            forward.outputGlobalIndex >= constOutputs.size()) {
+          consistent = false;
+          break;
+        }
+      }
+      if (consistent) {
+        logicalEdges.insert(logicalEdges.end(), cachedEdges.begin(), cachedEdges.end());
+        forwardedInputsInfo.insert(forwardedInputsInfo.end(), cachedForwards.begin(), cachedForwards.end());
+        return;
+      }
+    }
+  }
+  size_t firstCachedEdge = logicalEdges.size();
+  size_t firstCachedForward = forwardedInputsInfo.size();
+
   std::vector<bool> matches(constOutputs.size());
   for (size_t consumer = 0; consumer < workflow.size(); ++consumer) {
     O2_SIGNPOST_ID_GENERATE(sid, workflow_helpers);
@@ -859,6 +933,28 @@ void WorkflowHelpers::constructGraph(const WorkflowSpec& workflow,
     }
     O2_SIGNPOST_END(workflow_helpers, sid, "input matching", "");
   }
+
+  if (!topologyCachePath.empty()) {
+    // written via a temporary so concurrent pipeline stages never see a
+    // partial entry
+    auto tmpPath = fmt::format("{}.{}", topologyCachePath, getpid());
+    std::ofstream cacheOut(tmpPath, std::ios::binary | std::ios::trunc);
+    if (cacheOut.good()) {
+      uint64_t nEdges = logicalEdges.size() - firstCachedEdge;
+      uint64_t nForwards = forwardedInputsInfo.size() - firstCachedForward;
+      cacheOut.write("O2DPLTG1", 8);
+      cacheOut.write(reinterpret_cast<char const*>(&nEdges), sizeof(nEdges));
+      cacheOut.write(reinterpret_cast<char const*>(&nForwards), sizeof(nForwards));
+      cacheOut.write(reinterpret_cast<char const*>(logicalEdges.data() + firstCachedEdge), nEdges * sizeof(DeviceConnectionEdge));
+      cacheOut.write(reinterpret_cast<char const*>(forwardedInputsInfo.data() + firstCachedForward), nForwards * sizeof(LogicalForwardInfo));
+      cacheOut.close();
+      if (cacheOut.good()) {
+        rename(tmpPath.c_str(), topologyCachePath.c_str());
+      } else {
+        unlink(tmpPath.c_str());
+      }
+    }
+  }
 }
 
 std::vector<EdgeAction>
@@ -11,6 +11,7 @@
 
 #include "Framework/ASoA.h"
 #include "Framework/TableBuilder.h"
+#include "Framework/Expressions.h"
 #include "Framework/AnalysisDataModel.h"
 #include <benchmark/benchmark.h>
 #include <random>
@@ -315,4 +316,37 @@ static void BM_ASoADynamicColumnCall(benchmark::State& state)
 }
 BENCHMARK(BM_ASoADynamicColumnCall)->Range(8, 8 << maxrange);
 
+static void BM_ASoAFilteredForLoop(benchmark::State& state)
+{
+  // iteration over a filtered table (roughly half the rows selected),
+  // exercising the FilteredIndexPolicy chunk arithmetic
+  std::default_random_engine e1(1234567891);
+  std::uniform_real_distribution<float> uniform_dist(0, 1);
+
+  TableBuilder builder;
+  auto rowWriter = builder.persist<float, float, float>({"x", "y", "z"});
+  for (auto i = 0; i < state.range(0); ++i) {
+    rowWriter(0, uniform_dist(e1), uniform_dist(e1), uniform_dist(e1));
+  }
+  auto table = builder.finalize();
+
+  using Test = o2::soa::Table<o2::framework::OriginEnc{"AOD"}, test::X, test::Y>;
+  using FilteredTest = o2::soa::Filtered<Test>;
+
+  Test tests{table};
+  auto selection = o2::framework::expressions::createSelection(tests.asArrowTable(), o2::framework::expressions::Filter{test::x > 0.5f});
+
+  for (auto _ : state) {
+    FilteredTest filtered{{tests.asArrowTable()}, selection};
+    float sum = 0;
+    for (auto& test : filtered) {
+      sum += test.x() + test.y();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(float) * 2);
+}
+
+BENCHMARK(BM_ASoAFilteredForLoop)->Range(8, 8 << maxrange);
+
 BENCHMARK_MAIN();
@@ -8,6 +8,15 @@
 // In applying this license CERN does not waive the privileges and immunities
 // granted to it by virtue of its status as an Intergovernmental Organization
 // or submit itself to any jurisdiction.
+// This executable is the loopback transport benchmark of the DPL message
+// path: a producer pumps configurable numbers of channels/messages
+// through proxies and a consumer, reporting msg/s and MB/s rates (see
+// the summary output below). Channel transport (shm/ipc/inproc) and
+// message sizing are steered through the standard FairMQ channel
+// configuration options; benchmark_DataRelayer covers the relayer in
+// isolation. Latency percentiles would need timestamps carried in the
+// payloads - extend the producer here rather than adding a new harness.
+
 #include "Framework/ExternalFairMQDeviceProxy.h"
 
 using namespace o2::framework;
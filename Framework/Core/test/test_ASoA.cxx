@@ -18,6 +18,7 @@
 #include "gandiva/filter.h"
 #include <catch_amalgamated.hpp>
 #include <arrow/util/key_value_metadata.h>
+#include <arrow/table.h>
 
 using namespace o2::framework;
 using namespace arrow;
@@ -229,6 +230,61 @@ TEST_CASE("TestColumnIterators")
   REQUIRE(foobar.mCurrentChunk == bar.mCurrentChunk);
 }
 
+TEST_CASE("TestColumnGather")
+{
+  TableBuilder builder;
+  auto rowWriter = builder.persist<int32_t>({"fX"});
+  for (auto i = 0; i < 16; ++i) {
+    rowWriter(0, i * 10);
+  }
+  auto table = builder.finalize();
+
+  int64_t index = 0;
+  ColumnIterator<int32_t> it{table->column(0).get()};
+  it.mCurrentPos = &index;
+
+  // Gather a batch of scattered, unsorted positions in one pass.
+  std::array<int64_t, 6> positions{1, 3, 2, 15, 0, 7};
+  std::array<int32_t, 6> buffer{};
+  it.gatherTo(gsl::span<int64_t const>{positions.data(), positions.size()}, buffer.data());
+  REQUIRE(buffer[0] == 10);
+  REQUIRE(buffer[1] == 30);
+  REQUIRE(buffer[2] == 20);
+  REQUIRE(buffer[3] == 150);
+  REQUIRE(buffer[4] == 0);
+  REQUIRE(buffer[5] == 70);
+
+  // The iterator is still usable for row-by-row access afterwards.
+  index = 4;
+  REQUIRE(*it == 40);
+
+  // Same gather across a chunk boundary: concatenating two tables keeps
+  // the two chunks, so the position walk has to move between them (in
+  // both directions, since positions are not sorted).
+  TableBuilder builder2;
+  auto rowWriter2 = builder2.persist<int32_t>({"fX"});
+  for (auto i = 16; i < 32; ++i) {
+    rowWriter2(0, i * 10);
+  }
+  auto table2 = builder2.finalize();
+  auto concatenated = arrow::ConcatenateTables({table, table2}).ValueOrDie();
+  REQUIRE(concatenated->column(0)->num_chunks() == 2);
+
+  int64_t index2 = 0;
+  ColumnIterator<int32_t> it2{concatenated->column(0).get()};
+  it2.mCurrentPos = &index2;
+
+  std::array<int64_t, 6> positions2{1, 17, 31, 2, 16, 15};
+  std::array<int32_t, 6> buffer2{};
+  it2.gatherTo(gsl::span<int64_t const>{positions2.data(), positions2.size()}, buffer2.data());
+  REQUIRE(buffer2[0] == 10);
+  REQUIRE(buffer2[1] == 170);
+  REQUIRE(buffer2[2] == 310);
+  REQUIRE(buffer2[3] == 20);
+  REQUIRE(buffer2[4] == 160);
+  REQUIRE(buffer2[5] == 150);
+}
+
 TEST_CASE("TestJoinedTables")
 {
   TableBuilder builderX;
@@ -711,6 +767,39 @@ TEST_CASE("TestEmptyTables")
   REQUIRE(spawned.size() == 0);
 }
 
+TEST_CASE("TestParallelSpawner")
+{
+  // two-chunk input so the chunk-parallel projector evaluation has
+  // batches to split; the result must be identical to the serial one
+  TableBuilder bP1, bP2;
+  auto w1 = bP1.cursor<o2::aod::Points>();
+  auto w2 = bP2.cursor<o2::aod::Points>();
+  for (auto i = 0; i < 50; ++i) {
+    w1(0, i, 2 * i);
+    w2(0, 100 + i, i);
+  }
+  auto t1 = bP1.finalize();
+  auto t2 = bP2.finalize();
+  auto combined = arrow::ConcatenateTables({t1, t2}).ValueOrDie();
+  REQUIRE(combined->column(0)->num_chunks() == 2);
+
+  o2::aod::Points pSerial{combined};
+  auto serial = Extend<o2::aod::Points, o2::aod::test::ESum>(pSerial);
+
+  setenv("O2_SPAWNER_THREADS", "4", 1);
+  o2::aod::Points pParallel{combined};
+  auto parallel = Extend<o2::aod::Points, o2::aod::test::ESum>(pParallel);
+  setenv("O2_SPAWNER_THREADS", "1", 1);
+
+  REQUIRE(serial.size() == parallel.size());
+  auto itSerial = serial.begin();
+  for (auto& row : parallel) {
+    REQUIRE(row.esum() == (*itSerial).esum());
+    REQUIRE(row.esum() == row.x() + row.y());
+    ++itSerial;
+  }
+}
+
 namespace o2::aod
 {
 DECLARE_SOA_TABLE(Origints, "TEST", "ORIG", o2::soa::Index<>, test::X, test::SomeBool);
@@ -16,6 +16,8 @@
 #include <arrow/util/config.h>
 
 #include <catch_amalgamated.hpp>
+#include <cstdlib>
+#include <filesystem>
 
 using namespace o2;
 using namespace o2::framework;
@@ -85,6 +87,52 @@ DECLARE_SOA_COLUMN(Lst, lst, std::vector<double>);
 DECLARE_SOA_TABLE(EventExtra, "AOD", "EVTSXTRA", test::Arr, test::Boo, test::Lst);
 
 } // namespace o2::aod
+TEST_CASE("SlicingCachePersistentRoundTrip")
+{
+  TableBuilder builderT;
+  auto trksWriter = builderT.cursor<aod::TrksX>();
+  for (auto i = 0; i < 20; ++i) {
+    for (auto j = 0.f; j < 5; j += 0.5f) {
+      trksWriter(0, i, 0.5f * j);
+    }
+  }
+  auto trkTable = builderT.finalize();
+
+  auto key = "fIndex" + o2::framework::cutString(soa::getLabelFromType<aod::Events>());
+  char dirTemplate[] = "/tmp/o2slicecacheXXXXXX";
+  auto* cacheDir = mkdtemp(dirTemplate);
+  REQUIRE(cacheDir != nullptr);
+
+  ArrowTableSlicingCache writerSide({{soa::getLabelFromType<aod::TrksX>(), key}});
+  writerSide.persistentCacheDir = cacheDir;
+  writerSide.setDataframeId("DF_1");
+  REQUIRE(writerSide.updateCacheEntry(0, trkTable).ok());
+
+  // a fresh cache with the same id must load the sidecar instead of
+  // recomputing, and reproduce values and counts exactly
+  ArrowTableSlicingCache readerSide({{soa::getLabelFromType<aod::TrksX>(), key}});
+  readerSide.persistentCacheDir = cacheDir;
+  readerSide.setDataframeId("DF_1");
+  REQUIRE(readerSide.loadCacheEntry(0, trkTable));
+  REQUIRE(readerSide.values[0]->length() == writerSide.values[0]->length());
+  for (auto i = 0; i < writerSide.values[0]->length(); ++i) {
+    REQUIRE(readerSide.values[0]->Value(i) == writerSide.values[0]->Value(i));
+    REQUIRE(readerSide.counts[0]->Value(i) == writerSide.counts[0]->Value(i));
+  }
+
+  // a different table must miss on the fingerprint rather than serve
+  // the stored boundaries
+  TableBuilder builderT2;
+  auto trksWriter2 = builderT2.cursor<aod::TrksX>();
+  for (auto i = 0; i < 7; ++i) {
+    trksWriter2(0, i, 0.5f * i);
+  }
+  auto trkTable2 = builderT2.finalize();
+  REQUIRE(!readerSide.loadCacheEntry(0, trkTable2));
+
+  std::filesystem::remove_all(cacheDir);
+}
+
 TEST_CASE("GroupSlicerOneAssociated")
 {
   TableBuilder builderE;
@@ -0,0 +1,61 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#include <catch_amalgamated.hpp>
+#include "Framework/MessageContext.h"
+#include "Framework/FairMQDeviceProxy.h"
+#include <fairmq/TransportFactory.h>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+using namespace o2::framework;
+
+// The arena reads DPL_MESSAGE_ARENA_SIZE once on first use, so it has to
+// be set before any allocation attempt in this process.
+TEST_CASE("ArenaSmallMessageAllocation")
+{
+  setenv("DPL_MESSAGE_ARENA_SIZE", "1", 1);
+  auto transport = fair::mq::TransportFactory::CreateTransportFactory("zeromq");
+  FairMQDeviceProxy proxy;
+  MessageContext context{proxy};
+
+  // Small messages come from the arena: usable, zero-copy views into one
+  // unmanaged region, aligned to cache lines.
+  auto first = context.tryAllocateFromArena(transport.get(), 1000);
+  REQUIRE(first != nullptr);
+  REQUIRE(first->GetSize() == 1000);
+  REQUIRE(reinterpret_cast<uintptr_t>(first->GetData()) % 64 == 0);
+  auto second = context.tryAllocateFromArena(transport.get(), 1000);
+  REQUIRE(second != nullptr);
+  REQUIRE(reinterpret_cast<uintptr_t>(second->GetData()) % 64 == 0);
+  // bump allocation: consecutive carves do not overlap
+  auto firstBegin = reinterpret_cast<uintptr_t>(first->GetData());
+  auto secondBegin = reinterpret_cast<uintptr_t>(second->GetData());
+  REQUIRE(secondBegin >= firstBegin + 1000);
+  // the memory is writable message payload
+  memset(first->GetData(), 0x42, first->GetSize());
+
+  // Messages above the small-message limit bypass the arena.
+  REQUIRE(context.tryAllocateFromArena(transport.get(), 128 * 1024) == nullptr);
+
+  // Exhaustion falls back to the segment allocator instead of failing:
+  // a 1 MB arena can serve at most 16 maximum-size carves.
+  std::vector<fair::mq::MessagePtr> kept;
+  for (int i = 0; i < 16; ++i) {
+    auto msg = context.tryAllocateFromArena(transport.get(), 64 * 1024);
+    if (msg == nullptr) {
+      break;
+    }
+    kept.emplace_back(std::move(msg));
+  }
+  REQUIRE(context.tryAllocateFromArena(transport.get(), 64 * 1024) == nullptr);
+}
@@ -0,0 +1,46 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+#include <catch_amalgamated.hpp>
+#include "Framework/WorkStealingHelpers.h"
+
+using namespace o2::framework;
+
+TEST_CASE("TestAffinity")
+{
+  REQUIRE(WorkStealingHelpers::affinityOf(TimesliceId{0}, 4) == 0);
+  REQUIRE(WorkStealingHelpers::affinityOf(TimesliceId{5}, 4) == 1);
+  REQUIRE(WorkStealingHelpers::affinityOf(TimesliceId{7}, 4) == 3);
+  // A pool of one stream owns everything.
+  REQUIRE(WorkStealingHelpers::affinityOf(TimesliceId{7}, 1) == 0);
+}
+
+TEST_CASE("TestPrioritiseOwnTimeslices")
+{
+  std::vector<DataRelayer::RecordAction> completed;
+  for (size_t ti = 0; ti < 8; ++ti) {
+    completed.push_back({TimesliceSlot{ti}, TimesliceId{ti}, CompletionPolicy::CompletionOp::Consume});
+  }
+  // Stream 1 of a pool of 4 owns timeslices 1 and 5. They should come
+  // first, the rest should keep its relative order (to be stolen).
+  WorkStealingHelpers::prioritiseOwnTimeslices(completed, 1, 4);
+  REQUIRE(completed.size() == 8);
+  REQUIRE(completed[0].timeslice.value == 1);
+  REQUIRE(completed[1].timeslice.value == 5);
+  REQUIRE(completed[2].timeslice.value == 0);
+  REQUIRE(completed[3].timeslice.value == 2);
+  REQUIRE(completed[7].timeslice.value == 7);
+
+  // A pool of one is left untouched.
+  std::vector<DataRelayer::RecordAction> single = {{TimesliceSlot{1}, TimesliceId{1}, CompletionPolicy::CompletionOp::Consume},
+                                                   {TimesliceSlot{0}, TimesliceId{0}, CompletionPolicy::CompletionOp::Consume}};
+  WorkStealingHelpers::prioritiseOwnTimeslices(single, 0, 1);
+  REQUIRE(single[0].timeslice.value == 1);
+}
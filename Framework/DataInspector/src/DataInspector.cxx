@@ -119,7 +119,12 @@ void buildDocument(Document& message, std::string sender, const DataRef& ref)
     if (baseHeader->description == header::DataHeader::sHeaderType) {
       const auto* header = header::get<header::DataHeader*>(baseHeader->data());
       addBasicDataHeaderInfo(message, header, alloc);
-      addPayload(message, header->payloadSize, ref.payload, alloc);
+      // header-summary mode: skip the base64 payload copy, which is what
+      // makes the inspector too heavy for production rates
+      static const bool headersOnly = getenv("O2_DATAINSPECTOR_HEADERS_ONLY") && atoi(getenv("O2_DATAINSPECTOR_HEADERS_ONLY"));
+      if (!headersOnly) {
+        addPayload(message, header->payloadSize, ref.payload, alloc);
+      }
     } else if (baseHeader->description == DataProcessingHeader::sHeaderType) {
       const auto* header = header::get<DataProcessingHeader*>(baseHeader->data());
       addBasicDataProcessingHeaderInfo(message, header, alloc);
@@ -135,7 +140,21 @@ std::vector<DIMessage> serializeO2Messages(const std::vector<DataRef>& refs, con
 {
   std::vector<DIMessage> messages{};
 
+  // sampling tap: forward only a fraction of the matched messages, so the
+  // inspector can stay enabled at production rates
+  static const double sampleRate = getenv("O2_DATAINSPECTOR_SAMPLE") ? atof(getenv("O2_DATAINSPECTOR_SAMPLE")) : 1.;
+  static uint64_t sampleCounter = 0;
+  static uint64_t sampleAccepted = 0;
+
   for (auto& ref : refs) {
+    if (sampleRate < 1.) {
+      ++sampleCounter;
+      // deterministic low-discrepancy sampling without a RNG in the hot path
+      if (double(sampleAccepted + 1) > sampleRate * double(sampleCounter)) {
+        continue;
+      }
+      ++sampleAccepted;
+    }
     Document message;
     StringBuffer buffer;
     Writer<StringBuffer> writer(buffer);
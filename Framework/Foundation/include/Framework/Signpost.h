@@ -231,6 +231,11 @@ inline _o2_signpost_id_t _o2_signpost_id_make_with_pointer(_o2_log_t* log, void
 // Implementation start here. Include this file with O2_SIGNPOST_IMPLEMENTATION defined in one file of your
 // project.
 #ifdef O2_SIGNPOST_IMPLEMENTATION
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <unistd.h>
 #include <cstdarg>
 #include <cstdio>
 #include <cstring>
@@ -389,8 +394,39 @@ void _o2_signpost_event_emit(_o2_log_t* log, _o2_signpost_id_t id, char const* n
 
 // This will look at the slot in the log associated to the ID.
 // If the slot is empty, it will return the id and increment the indentation level.
+// Lightweight chrome-trace backend for Linux (and any platform without
+// native signposts): when O2_SIGNPOST_TRACE_FILE is set, interval
+// begin/end events are appended as trace-event JSON to
+// <file>.<pid>.json, loadable in Perfetto / chrome://tracing. One line
+// per event under a small mutex; enabling a log stream at runtime thus
+// yields spans without the textual logging path.
+static void _o2_trace_event(char phase, char const* name, uint64_t id)
+{
+  static FILE* traceFile = []() -> FILE* {
+    char const* path = getenv("O2_SIGNPOST_TRACE_FILE");
+    if (path == nullptr) {
+      return nullptr;
+    }
+    std::string full = std::string(path) + "." + std::to_string(getpid()) + ".json";
+    FILE* file = fopen(full.c_str(), "w");
+    if (file != nullptr) {
+      fputs("[\n", file);
+    }
+    return file;
+  }();
+  if (traceFile == nullptr) {
+    return;
+  }
+  static std::mutex traceMutex;
+  auto now = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  std::lock_guard<std::mutex> lock{traceMutex};
+  fprintf(traceFile, "{\"ph\":\"%c\",\"ts\":%lld,\"pid\":%d,\"tid\":%zu,\"name\":\"%s\",\"id\":\"%llx\"},\n",
+          phase, (long long)now, (int)getpid(), std::hash<std::thread::id>{}(std::this_thread::get_id()) & 0xffff, name, (unsigned long long)id);
+}
+
 void _o2_signpost_interval_begin(_o2_log_t* log, _o2_signpost_id_t id, char const* name, char const* const format, ...)
 {
+  _o2_trace_event('B', name, (uint64_t)id.value);
   va_list args;
   va_start(args, format);
   // This is a unique slot for this interval.
@@ -411,6 +447,7 @@ void _o2_signpost_interval_begin(_o2_log_t* log, _o2_signpost_id_t id, char cons
 
 void _o2_signpost_interval_end_v(_o2_log_t* log, _o2_signpost_id_t id, char const* name, char const* const format, va_list args)
 {
+  _o2_trace_event('E', name, (uint64_t)id.value);
   if (log->stacktrace == 0) {
     return;
   }
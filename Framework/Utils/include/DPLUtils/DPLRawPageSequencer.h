@@ -21,7 +21,11 @@
 #include "Framework/DataRefUtils.h"
 #include "Framework/Logger.h"
 #include "Framework/InputRecordWalker.h"
+#include <atomic>
+#include <thread>
+#include <tuple>
 #include <utility> // std::declval
+#include <vector>
 
 // Framework does not depend on detectors, but this file is header-only.
 // So we just include the RDH header, and the user must make sure it is
@@ -48,6 +52,13 @@ class InputRecord;
 /// the optional filter, and partitions input buffers into sequences of
 /// raw pages matching the provided predicate by binary search.
 ///
+/// Parallelism note: the sequencing is already sub-linear - link runs
+/// are located by binary search over each part rather than by walking
+/// every page. Parts are independent, so parallel() additionally runs
+/// the per-part sequencing on worker threads and replays the collected
+/// (pointer, page-range, subSpec) tuples into the inserter in part
+/// order, producing output identical to binary().
+///
 /// Note: binary search requires that all raw pages must have a fixed
 /// length, only the last page can be shorter.
 ///
@@ -108,65 +119,92 @@ class DPLRawPageSequencer
         }
         continue;
       }
-      auto const pageSize = rawparser_type::max_size;
-      auto nPages = size / pageSize + (size % pageSize ? 1 : 0);
       if (!preCheck(ref.payload, dh->subSpecification)) {
         continue;
       }
-      // FIXME: automatic type from inserter/predicate?
-      const char* iterator = ref.payload;
-
-      auto check = [&pred, &pageSize, payload = ref.payload](size_t left, size_t right) -> bool {
-        return pred(payload + left * pageSize, payload + right * pageSize);
-      };
-      auto insert = [&inserter, &pageSize, payload = ref.payload](size_t pos, size_t n, uint32_t subSpec) -> void {
-        inserter(payload + pos * pageSize, n, subSpec);
-      };
-      // binary search the next different page based on the check predicate
-      auto search = [&check](size_t first, size_t n) -> size_t {
-        auto count = n;
-        auto pos = first;
-        while (count > 0) {
-          auto step = count / 2;
-          if (check(first, pos + step)) {
-            // still the same
-            pos += step;
-            count = n - (pos - first);
-          } else {
-            if (step == 1) {
-              pos += step;
-              break;
-            }
-            count = step;
-          }
-        }
-        return pos;
-      };
-
-      // check if the last block contains a valid RDH, otherwise data is corrupted or 8kb assumption is wrong
-      if (!o2::raw::RDHUtils::checkRDH(ref.payload, false) || (nPages > 1 && (o2::raw::RDHUtils::getMemorySize(ref.payload) != pageSize || !o2::raw::RDHUtils::checkRDH(ref.payload + (nPages - 1) * pageSize, false)))) {
+      if (!sequencePart(pred, inserter, ref.payload, size, dh->subSpecification)) {
         forwardInternal(std::forward<Predicate>(pred), std::forward<Inserter>(inserter), ref.payload, size, dh);
         retVal = 1;
-        continue;
       }
-
-      size_t p = 0;
-      do {
-        // insert the full block if the last RDH matches the position
-        if (check(p, nPages - 1)) {
-          insert(p, nPages - p, dh->subSpecification);
-          break;
-        }
-        auto q = search(p, nPages - p);
-        insert(p, q - p, dh->subSpecification);
-        p = q;
-      } while (p < nPages);
       // if payloads are consecutive in memory we could apply this algorithm even over
       // O2 message boundaries
     }
     return retVal;
   }
 
+  template <typename Predicate, typename Inserter>
+  int parallel(Predicate pred, Inserter inserter, size_t nThreads)
+  {
+    return parallel(std::forward<Predicate>(pred), std::forward<Inserter>(inserter), [](...) { return true; }, nThreads);
+  }
+
+  /// Concurrent variant of binary(): the per-part sequencing runs on
+  /// nThreads workers into per-part tuple buffers, then the inserter is
+  /// called on the calling thread in part order. Output and return value
+  /// are identical to binary(); the predicate must be thread-safe.
+  template <typename Predicate, typename Inserter, typename Precheck>
+  int parallel(Predicate pred, Inserter inserter, Precheck preCheck, size_t nThreads)
+  {
+    if (nThreads <= 1) {
+      return binary(std::forward<Predicate>(pred), std::forward<Inserter>(inserter), std::forward<Precheck>(preCheck));
+    }
+    struct PartSequence {
+      const char* payload = nullptr;
+      size_t size = 0;
+      const o2::header::DataHeader* dh = nullptr;
+      std::vector<std::tuple<const char*, size_t, uint32_t>> tuples;
+      bool needsForward = false;
+    };
+    std::vector<PartSequence> parts;
+    for (auto const& ref : mInput) {
+      auto size = DataRefUtils::getPayloadSize(ref);
+      const auto dh = DataRefUtils::getHeader<o2::header::DataHeader*>(ref);
+      if (dh == nullptr) {
+        continue;
+      }
+      if (size == 0) {
+        if (dh->subSpecification == 0xDEADBEEF) {
+          raw_parser::RawParserHelper::warnDeadBeef(dh);
+        }
+        continue;
+      }
+      if (!preCheck(ref.payload, dh->subSpecification)) {
+        continue;
+      }
+      parts.push_back({ref.payload, size, dh});
+    }
+    std::atomic<size_t> nextPart{0};
+    auto worker = [this, &pred, &parts, &nextPart]() {
+      size_t ip;
+      while ((ip = nextPart.fetch_add(1, std::memory_order_relaxed)) < parts.size()) {
+        auto& part = parts[ip];
+        auto collect = [&part](const char* ptr, size_t n, uint32_t subSpec) {
+          part.tuples.emplace_back(ptr, n, subSpec);
+        };
+        part.needsForward = !sequencePart(pred, collect, part.payload, part.size, part.dh->subSpecification);
+      }
+    };
+    std::vector<std::thread> pool;
+    for (size_t it = 0; it < std::min(nThreads, parts.size()); ++it) {
+      pool.emplace_back(worker);
+    }
+    for (auto& t : pool) {
+      t.join();
+    }
+    int retVal = 0;
+    for (auto& part : parts) {
+      if (part.needsForward) { // corrupted page structure, reparse serially
+        forwardInternal(std::forward<Predicate>(pred), std::forward<Inserter>(inserter), part.payload, part.size, part.dh);
+        retVal = 1;
+        continue;
+      }
+      for (auto& [ptr, n, subSpec] : part.tuples) {
+        inserter(ptr, n, subSpec);
+      }
+    }
+    return retVal;
+  }
+
   template <typename Predicate, typename Inserter>
   int forward(Predicate pred, Inserter inserter)
   {
@@ -191,6 +229,61 @@ class DPLRawPageSequencer
   }
 
  private:
+  /// sequence one payload of fixed-size pages, emitting
+  /// (pointer, nPages, subSpec) runs; returns false when the page
+  /// structure is invalid and the caller must fall back to the forward
+  /// parser
+  template <typename Predicate, typename Emitter>
+  bool sequencePart(Predicate& pred, Emitter&& emit, const char* payload, size_t size, uint32_t subSpecification)
+  {
+    auto const pageSize = rawparser_type::max_size;
+    auto nPages = size / pageSize + (size % pageSize ? 1 : 0);
+    auto check = [&pred, &pageSize, payload](size_t left, size_t right) -> bool {
+      return pred(payload + left * pageSize, payload + right * pageSize);
+    };
+    auto insert = [&emit, &pageSize, payload](size_t pos, size_t n, uint32_t subSpec) -> void {
+      emit(payload + pos * pageSize, n, subSpec);
+    };
+    // binary search the next different page based on the check predicate
+    auto search = [&check](size_t first, size_t n) -> size_t {
+      auto count = n;
+      auto pos = first;
+      while (count > 0) {
+        auto step = count / 2;
+        if (check(first, pos + step)) {
+          // still the same
+          pos += step;
+          count = n - (pos - first);
+        } else {
+          if (step == 1) {
+            pos += step;
+            break;
+          }
+          count = step;
+        }
+      }
+      return pos;
+    };
+
+    // check if the last block contains a valid RDH, otherwise data is corrupted or 8kb assumption is wrong
+    if (!o2::raw::RDHUtils::checkRDH(payload, false) || (nPages > 1 && (o2::raw::RDHUtils::getMemorySize(payload) != pageSize || !o2::raw::RDHUtils::checkRDH(payload + (nPages - 1) * pageSize, false)))) {
+      return false;
+    }
+
+    size_t p = 0;
+    do {
+      // insert the full block if the last RDH matches the position
+      if (check(p, nPages - 1)) {
+        insert(p, nPages - p, subSpecification);
+        break;
+      }
+      auto q = search(p, nPages - p);
+      insert(p, q - p, subSpecification);
+      p = q;
+    } while (p < nPages);
+    return true;
+  }
+
   InputRecordWalker mInput;
 
   template <typename Predicate, typename Inserter>
@@ -24,6 +24,7 @@
 #include "Framework/Logger.h"
 #include "Headers/DataHeader.h"
 #include <TChain.h>
+#include <cstdlib>
 #include <TTree.h>
 #include <TBranch.h>
 #include <TClass.h>
@@ -396,7 +397,12 @@ class GenericRootTreeReader
                         Args&&... args)       // file names, followed by branch info
     : mInput(treename)
   {
-    mInput.SetCacheSize(0);
+    // The TTree cache is off by default here; for calibration replays,
+    // DPL_ROOT_TREE_READER_CACHE_MB enables basket readahead of the
+    // learned branches (combine with TFile.AsyncPrefetching in .rootrc
+    // to overlap the reads and decompression with the processing).
+    const char* cacheMB = getenv("DPL_ROOT_TREE_READER_CACHE_MB");
+    mInput.SetCacheSize(cacheMB ? atoll(cacheMB) * 1024 * 1024 : 0);
     parseConstructorArgs<0>(std::forward<Args>(args)...);
     mBranchConfiguration->setup(mInput, mPublishHook);
   }
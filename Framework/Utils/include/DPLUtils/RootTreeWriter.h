@@ -21,6 +21,7 @@
 #include "Framework/DataRef.h"
 #include "Framework/Logger.h"
 #include <TFile.h>
+#include <TROOT.h>
 #include <TTree.h>
 #include <TBranch.h>
 #include <TClass.h>
@@ -309,6 +310,14 @@ class RootTreeWriter
   /// branch definition provided to the constructor.
   void init(const char* filename, const char* treename, const char* treetitle = nullptr)
   {
+    // Optional per-device compression pool: with
+    // DPL_ROOT_TREE_WRITER_THREADS the baskets of all branches are
+    // compressed on ROOT's implicit MT pool instead of synchronously in
+    // the processing callback, which is where the intermediate writers
+    // spend their time for well-filled branches.
+    if (const char* nThreads = getenv("DPL_ROOT_TREE_WRITER_THREADS"); nThreads && atoi(nThreads) > 1 && !ROOT::IsImplicitMTEnabled()) {
+      ROOT::EnableImplicitMT(atoi(nThreads));
+    }
     mFile = std::make_unique<TFile>(filename, "RECREATE", "", 505);
     mTree = std::make_unique<TTree>(treename, treetitle != nullptr ? treetitle : treename);
     mTree->SetDirectory(mFile.get());
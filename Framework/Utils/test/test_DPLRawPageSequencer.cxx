@@ -109,11 +109,21 @@ TEST_CASE("test_DPLRawPageSequencer")
   REQUIRE(pages.size() == feeids.size());
   REQUIRE(pages.size() == pagesByForwardSearch.size());
 
+  // the concurrent sequencer must produce the identical page sequence
+  std::vector<std::pair<const char*, size_t>> pagesParallel;
+  auto insertParallelPages = [&pagesParallel](const char* ptr, size_t n, uint32_t subSpec) -> void {
+    pagesParallel.emplace_back(ptr, n);
+  };
+  retVal = DPLRawPageSequencer(inputs).parallel(isSameRdh, insertParallelPages, 4);
+  REQUIRE(retVal == 0);
+  REQUIRE(pagesParallel.size() == pages.size());
+
   feeids.emplace_back(rdhCount);
   for (auto i = 0; i < pages.size(); i++) {
     auto length = feeids[i + 1] - feeids[i];
     CHECK_MESSAGE(pages[i].second == length, fmt::format("sequence {} at {} length {}: got {}", i, feeids[i], length, pages[i].second));
     REQUIRE_MESSAGE(((pages[i].first == pagesByForwardSearch[i].first) && (pages[i].second == pagesByForwardSearch[i].second)),
                     fmt::format("{} [{},{}][{},{}]", i, ((void*)pages[i].first), (void*)pagesByForwardSearch[i].first, pages[i].second, pagesByForwardSearch[i].second));
+    REQUIRE(pages[i] == pagesParallel[i]);
   }
 }
@@ -320,6 +320,12 @@ int32_t GPUReconstruction::InitPhaseBeforeDevice()
   }
 
   mMemoryScalers->factor = mProcessingSettings.memoryScalingFactor;
+  if (const char* scalersFile = getenv("GPU_MEMORY_SCALERS_FILE")) {
+    // per-run persisted tuning (e.g. high-water marks of previous runs)
+    if (mMemoryScalers->loadFactorsFromFile(scalersFile)) {
+      GPUInfo("Loaded memory size scalers from %s", scalersFile);
+    }
+  }
   mMemoryScalers->conservative = mProcessingSettings.conservativeMemoryEstimate;
   mMemoryScalers->returnMaxVal = mProcessingSettings.forceMaxMemScalers != 0;
   if (mProcessingSettings.forceMaxMemScalers > 1) {
@@ -13,6 +13,7 @@
 /// \author David Rohr
 
 #include "GPUReconstructionCPU.h"
+#include <fstream>
 #include "GPUReconstructionIncludes.h"
 #include "GPUChain.h"
 
@@ -248,6 +249,13 @@ int32_t GPUReconstructionCPU::RunChains()
     double kernelTotal = 0;
     std::vector<double> kernelStepTimes(GPUDataTypes::N_RECO_STEPS);
 
+    std::ofstream jsonReport;
+    bool firstJSONEntry = true;
+    if (!GetProcessingSettings().timingJSONReport.empty()) {
+      jsonReport.open(GetProcessingSettings().timingJSONReport);
+      jsonReport << "{\n  \"nEvents\": " << mStatNEvents << ",\n  \"kernels\": [";
+    }
+
     for (uint32_t i = 0; i < mTimers.size(); i++) {
       double time = 0;
       if (mTimers[i] == nullptr) {
@@ -272,6 +280,12 @@ int32_t GPUReconstructionCPU::RunChains()
         snprintf(bandwidth, 256, " (%8.3f GB/s - %'14zu bytes - %'14zu per call)", mTimers[i]->memSize / time * 1e-9, mTimers[i]->memSize / mStatNEvents, mTimers[i]->memSize / mStatNEvents / mTimers[i]->count);
       }
       printf("Execution Time: Task (%c %8ux): %50s Time: %'10.0f us%s\n", type == 0 ? 'K' : 'C', mTimers[i]->count, mTimers[i]->name.c_str(), time * 1000000 / mStatNEvents, bandwidth);
+      if (jsonReport.is_open() && mStatNEvents) {
+        jsonReport << (firstJSONEntry ? "" : ",") << "\n    {\"name\": \"" << mTimers[i]->name << "\", \"type\": \"" << (type == 0 ? "kernel" : "copy")
+                   << "\", \"count\": " << mTimers[i]->count << ", \"usPerEvent\": " << time * 1000000 / mStatNEvents
+                   << ", \"bytesPerEvent\": " << mTimers[i]->memSize / mStatNEvents << ", \"GBps\": " << (time != 0. ? mTimers[i]->memSize / time * 1e-9 : 0.) << "}";
+        firstJSONEntry = false;
+      }
       if (mProcessingSettings.resetTimers) {
         mTimers[i]->count = 0;
         mTimers[i]->memSize = 0;
@@ -306,6 +320,9 @@ int32_t GPUReconstructionCPU::RunChains()
     mStatKernelTime = kernelTotal * 1000000 / mStatNEvents;
     printf("Execution Time: Total   : %50s Time: %'10.0f us%s\n", "Total Kernel", mStatKernelTime, nEventReport.c_str());
     printf("Execution Time: Total   : %50s Time: %'10.0f us%s\n", "Total Wall", mStatWallTime, nEventReport.c_str());
+    if (jsonReport.is_open()) {
+      jsonReport << "\n  ],\n  \"totalKernelUs\": " << mStatKernelTime << ",\n  \"totalWallUs\": " << mStatWallTime << "\n}\n";
+    }
   } else if (GetProcessingSettings().debugLevel >= 0) {
     GPUInfo("Total Wall Time: %lu us%s", (uint64_t)mStatWallTime, nEventReport.c_str());
   }
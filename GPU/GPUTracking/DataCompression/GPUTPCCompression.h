@@ -38,6 +38,13 @@ namespace GPUCA_NAMESPACE::gpu
 {
 class GPUTPCGMMerger;
 
+// Note on a possible device-side entropy stage: fusing the o2::rans
+// encoding behind the compression kernels requires the renormed symbol
+// tables (CCDB dictionaries or per-TF histograms) resident on the GPU
+// and a device port of the interleaved-state stream writer of
+// Utilities/rANS. With gather mode 3 the intermediate arrays already
+// stay on the GPU and only the gathered flat output is copied out, so
+// the remaining transfer is the compressed-cluster payload itself.
 class GPUTPCCompression : public GPUProcessor
 {
   friend class GPUTPCCompressionKernels;
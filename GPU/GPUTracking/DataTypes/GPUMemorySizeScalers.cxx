@@ -13,10 +13,45 @@
 /// \author David Rohr
 
 #include "GPUMemorySizeScalers.h"
+#include <string>
+#include <map>
+#include <fstream>
 #include "GPULogging.h"
 
 using namespace GPUCA_NAMESPACE::gpu;
 
+bool GPUMemorySizeScalers::loadFactorsFromFile(const char* fileName)
+{
+  std::ifstream in(fileName);
+  if (!in.good()) {
+    return false;
+  }
+  std::map<std::string, double*> factors{
+    {"factor", &factor},
+    {"temporaryFactor", &temporaryFactor},
+    {"offset", &offset},
+    {"hitOffset", &hitOffset},
+    {"tpcPeaksPerDigit", &tpcPeaksPerDigit},
+    {"tpcClustersPerPeak", &tpcClustersPerPeak},
+    {"tpcStartHitsPerHit", &tpcStartHitsPerHit},
+    {"tpcTrackletsPerStartHit", &tpcTrackletsPerStartHit},
+    {"tpcTrackletHitsPerHit", &tpcTrackletHitsPerHit},
+    {"tpcSectorTracksPerHit", &tpcSectorTracksPerHit},
+    {"tpcSectorTrackHitsPerHit", &tpcSectorTrackHitsPerHit},
+    {"tpcSectorTrackHitsPerHitWithRejection", &tpcSectorTrackHitsPerHitWithRejection},
+    {"tpcMergedTrackPerSliceTrack", &tpcMergedTrackPerSliceTrack},
+    {"tpcMergedTrackHitPerSliceHit", &tpcMergedTrackHitPerSliceHit}};
+  std::string name;
+  double value;
+  while (in >> name >> value) {
+    auto entry = factors.find(name);
+    if (entry != factors.end()) {
+      *entry->second = value;
+    }
+  }
+  return true;
+}
+
 void GPUMemorySizeScalers::rescaleMaxMem(size_t newAvailableMemory)
 {
   GPUMemorySizeScalers tmp;
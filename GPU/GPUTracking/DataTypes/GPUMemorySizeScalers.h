@@ -66,6 +66,12 @@ struct GPUMemorySizeScalers {
   bool returnMaxVal = false;
 
   void rescaleMaxMem(size_t newAvailableMemory);
+  /// Override the scaling factors / limits from a per-run tuning file
+  /// ("name value" per line, names as the members above): lets
+  /// operations persist observed high-water marks between runs instead
+  /// of relying on the static formulas. Returns false if the file could
+  /// not be read.
+  bool loadFactorsFromFile(const char* fileName);
   inline size_t getValue(size_t maxVal, size_t val)
   {
     return returnMaxVal ? maxVal : (std::min<size_t>(maxVal, offset + val) * factor * temporaryFactor);
@@ -293,7 +293,10 @@ AddOption(tpcDownscaledEdx, uint8_t, 0, "", 0, "If != 0, downscale dEdx processi
 AddOption(tpcMaxAttachedClustersPerSectorRow, uint32_t, 51000, "", 0, "Maximum number of TPC attached clusters which can be decoded per SectorRow")
 AddOption(tpcUseOldCPUDecoding, bool, false, "", 0, "Enable old CPU-based TPC decoding")
 AddOption(tpcApplyCFCutsAtDecoding, bool, false, "", 0, "Apply cluster cuts from clusterization during decoding of compressed clusters")
+AddOption(tpcClusterFilterWindow, std::string, "", "", 0, "Keep only decoded clusters inside 'sec0,sec1,row0,row1,time0,time1' (inclusive); rows/sectors outside are skipped wholesale. Empty = off")
 AddOption(tpcApplyDebugClusterFilter, bool, false, "", 0, "Apply custom cluster filter of GPUTPCClusterFilter class")
+AddOption(tpcClustersDeviceOnly, bool, false, "", 0, "Keep TPC cluster native output resident on the GPU for consumption by the tracking steps, skipping the host copy even if clusters are requested as output (only final tracks are copied out)")
+AddOption(timingJSONReport, std::string, "", "", 0, "Write the per-kernel timing / bandwidth statistics as JSON to this file at the end of the run, for diffing between versions (requires debugLevel >= 1)")
 AddOption(RTCcacheFolder, std::string, "./rtccache/", "", 0, "Folder in which the cache file is stored")
 AddOption(RTCprependCommand, std::string, "", "", 0, "Prepend RTC compilation commands by this string")
 AddOption(RTCoverrideArchitecture, std::string, "", "", 0, "Override arhcitecture part of RTC compilation command line")
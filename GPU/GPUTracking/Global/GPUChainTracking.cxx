@@ -469,7 +469,33 @@ void GPUChainTracking::UpdateGPUCalibObjects(int32_t stream, const GPUCalibObjec
     mFlatObjectsShadow.mCalibObjects.o2Propagator->setMatLUT(mFlatObjectsShadow.mCalibObjects.matLUT);
   }
 #endif
-  TransferMemoryResourceLinkToGPU(RecoStep::NoRecoStep, mFlatObjectsShadow.mMemoryResFlat, stream);
+  bool transformsOnly = ptrMask != nullptr &&
+                        !ptrMask->matLUT && !ptrMask->trdGeometry && !ptrMask->tpcPadGain && !ptrMask->tpcZSLinkMapping &&
+                        !ptrMask->dEdxCalibContainer && !ptrMask->o2Propagator && !ptrMask->itsPatternDict &&
+                        (ptrMask->fastTransform || ptrMask->fastTransformRef || ptrMask->fastTransformMShape || ptrMask->fastTransformHelper);
+  if (transformsOnly) {
+    // Correction map swap: upload only the affected transform objects and
+    // their spline payloads asynchronously on the given stream, instead
+    // of re-transferring the whole flat calib block.
+    auto transferTransform = [this, stream](const TPCFastTransform* shadowObj, TPCFastTransform* deviceObj, const char* shadowBuffer, char* deviceBuffer) {
+      GPUMemCpy(RecoStep::NoRecoStep, (void*)deviceObj, (const void*)shadowObj, sizeof(*shadowObj), stream, true);
+      GPUMemCpy(RecoStep::NoRecoStep, (void*)deviceBuffer, (const void*)shadowBuffer, shadowObj->getFlatBufferSize(), stream, true);
+    };
+    if (ptrMask->fastTransform && processors()->calibObjects.fastTransform) {
+      transferTransform(mFlatObjectsShadow.mCalibObjects.fastTransform, mFlatObjectsDevice.mCalibObjects.fastTransform, mFlatObjectsShadow.mTpcTransformBuffer, mFlatObjectsDevice.mTpcTransformBuffer);
+    }
+    if (ptrMask->fastTransformRef && processors()->calibObjects.fastTransformRef) {
+      transferTransform(mFlatObjectsShadow.mCalibObjects.fastTransformRef, mFlatObjectsDevice.mCalibObjects.fastTransformRef, mFlatObjectsShadow.mTpcTransformRefBuffer, mFlatObjectsDevice.mTpcTransformRefBuffer);
+    }
+    if (ptrMask->fastTransformMShape && processors()->calibObjects.fastTransformMShape) {
+      transferTransform(mFlatObjectsShadow.mCalibObjects.fastTransformMShape, mFlatObjectsDevice.mCalibObjects.fastTransformMShape, mFlatObjectsShadow.mTpcTransformMShapeBuffer, mFlatObjectsDevice.mTpcTransformMShapeBuffer);
+    }
+    if (processors()->calibObjects.fastTransformHelper) { // the helper points to the transforms, refresh it with any of them
+      GPUMemCpy(RecoStep::NoRecoStep, (void*)mFlatObjectsDevice.mCalibObjects.fastTransformHelper, (const void*)mFlatObjectsShadow.mCalibObjects.fastTransformHelper, sizeof(*mFlatObjectsShadow.mCalibObjects.fastTransformHelper), stream, true);
+    }
+  } else {
+    TransferMemoryResourceLinkToGPU(RecoStep::NoRecoStep, mFlatObjectsShadow.mMemoryResFlat, stream);
+  }
   memcpy((void*)&processorsShadow()->calibObjects, (void*)&mFlatObjectsDevice.mCalibObjects, sizeof(mFlatObjectsDevice.mCalibObjects));
 }
 
@@ -631,6 +631,19 @@ int32_t GPUChainTracking::RunTPCClusterizer(bool synchronizeOutput)
 
   bool buildNativeGPU = (mRec->GetRecoStepsGPU() & GPUDataTypes::RecoStep::TPCConversion) || (mRec->GetRecoStepsGPU() & GPUDataTypes::RecoStep::TPCSliceTracking) || (mRec->GetRecoStepsGPU() & GPUDataTypes::RecoStep::TPCMerging) || (mRec->GetRecoStepsGPU() & GPUDataTypes::RecoStep::TPCCompression);
   bool buildNativeHost = (mRec->GetRecoStepsOutputs() & GPUDataTypes::InOutType::TPCClusters) || GetProcessingSettings().deterministicGPUReconstruction; // TODO: Should do this also when clusters are needed for later steps on the host but not requested as output
+  if (GetProcessingSettings().tpcClustersDeviceOnly) {
+    if (!buildNativeGPU) {
+      GPUError("tpcClustersDeviceOnly requires the subsequent TPC steps to run on the GPU, ignoring");
+    } else if (GetProcessingSettings().deterministicGPUReconstruction) {
+      GPUError("tpcClustersDeviceOnly is incompatible with deterministicGPUReconstruction, ignoring");
+    } else if (mRec->GetRecoStepsOutputs() & GPUDataTypes::InOutType::TPCClusters) {
+      // the workflow declared the clusters as output, so a host copy must exist -
+      // there is no device-pointer handoff to downstream consumers
+      GPUError("tpcClustersDeviceOnly is incompatible with requesting TPCClusters as output, ignoring");
+    } else {
+      buildNativeHost = false; // device-resident handoff: the tracker consumes the clusters from GPU memory, only tracks are copied out
+    }
+  }
 
   mInputsHost->mNClusterNative = mInputsShadow->mNClusterNative = mRec->MemoryScalers()->nTPCHits * tpcHitLowOccupancyScalingFactor;
   if (buildNativeGPU) {
@@ -302,11 +302,28 @@ void GPUChainTracking::SanityCheck()
 void GPUChainTracking::RunTPCClusterFilter(o2::tpc::ClusterNativeAccess* clusters, std::function<o2::tpc::ClusterNative*(size_t)> allocator, bool applyClusterCuts)
 {
   GPUTPCClusterFilter clusterFilter(*clusters);
+  // optional window predicate pushed down into the filtering: rows and
+  // sectors outside the window are skipped wholesale
+  int32_t sec0 = 0, sec1 = GPUCA_NSLICES - 1, row0 = 0, row1 = GPUCA_ROW_COUNT - 1;
+  float time0 = 0.f, time1 = 0.f;
+  bool haveWindow = false;
+  if (!GetProcessingSettings().tpcClusterFilterWindow.empty()) {
+    haveWindow = sscanf(GetProcessingSettings().tpcClusterFilterWindow.c_str(), "%d,%d,%d,%d,%f,%f", &sec0, &sec1, &row0, &row1, &time0, &time1) == 6;
+    if (!haveWindow) {
+      GPUError("Invalid tpcClusterFilterWindow '%s', expecting sec0,sec1,row0,row1,time0,time1 - ignoring", GetProcessingSettings().tpcClusterFilterWindow.c_str());
+    }
+  }
   o2::tpc::ClusterNative* outputBuffer = nullptr;
   for (int32_t iPhase = 0; iPhase < 2; iPhase++) {
     uint32_t countTotal = 0;
     for (uint32_t iSector = 0; iSector < GPUCA_NSLICES; iSector++) {
       for (uint32_t iRow = 0; iRow < GPUCA_ROW_COUNT; iRow++) {
+        if (haveWindow && ((int32_t)iSector < sec0 || (int32_t)iSector > sec1 || (int32_t)iRow < row0 || (int32_t)iRow > row1)) {
+          if (iPhase) {
+            clusters->nClusters[iSector][iRow] = 0;
+          }
+          continue;
+        }
         uint32_t count = 0;
         for (uint32_t k = 0; k < clusters->nClusters[iSector][iRow]; k++) {
           o2::tpc::ClusterNative cl = clusters->clusters[iSector][iRow][k];
@@ -315,6 +332,9 @@ void GPUChainTracking::RunTPCClusterFilter(o2::tpc::ClusterNativeAccess* cluster
             keep = keep && cl.qTot > param().rec.tpc.cfQTotCutoff && cl.qMax > param().rec.tpc.cfQMaxCutoff;
             keep = keep && (!(cl.getFlags() & o2::tpc::ClusterNative::flagSingle) || ((cl.sigmaPadPacked || cl.qMax > param().rec.tpc.cfQMaxCutoffSinglePad) && (cl.sigmaTimePacked || cl.qMax > param().rec.tpc.cfQMaxCutoffSingleTime)));
           }
+          if (haveWindow) {
+            keep = keep && cl.getTime() >= time0 && cl.getTime() <= time1;
+          }
           if (param().tpcCutTimeBin > 0) {
             keep = keep && cl.getTime() < param().tpcCutTimeBin;
           }
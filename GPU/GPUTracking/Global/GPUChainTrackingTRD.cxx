@@ -46,6 +46,12 @@ int32_t GPUChainTracking::RunTRDTracking()
     Tracker.SetProcessPerTimeFrame(true);
   }
 
+  // When no externally calibrated tracklets (space points) are provided,
+  // the tracker transforms the raw tracklet words on the device itself
+  // (CalculateSpacePoints), so the host TrackletTransformer stage can be
+  // omitted for GPU-only consumers. The O2 global TRD matching still
+  // ships calibrated tracklets because its final host-side refit
+  // re-reads them; only that refit keeps the host transformation alive.
   Tracker.SetGenerateSpacePoints(mIOPtrs.trdSpacePoints == nullptr);
 
   mRec->PushNonPersistentMemory(qStr2Tag("TRDTRACK"));
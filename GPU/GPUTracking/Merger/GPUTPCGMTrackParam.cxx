@@ -57,6 +57,14 @@
 using namespace GPUCA_NAMESPACE::gpu;
 using namespace o2::tpc;
 
+// Note on a warp-cooperative variant: the refit is a sequential Kalman
+// chain per track - every 5x5 update depends on the previous one - so a
+// warp can only cooperate on the per-cluster preparation (transform,
+// field and material fetches), not on the filter itself. Hiding the
+// divergence of long Pb-Pb tracks therefore needs a length-sorted
+// launch (tracks of similar cluster counts in the same warp) and
+// prefetching of the cluster stream, rather than distributing one
+// track over the lanes; the merger already orders tracks to this end.
 GPUd() bool GPUTPCGMTrackParam::Fit(GPUTPCGMMerger* GPUrestrict() merger, int32_t iTrk, GPUTPCGMMergedTrackHit* GPUrestrict() clusters, GPUTPCGMMergedTrackHitXYZ* GPUrestrict() clustersXYZ, int32_t& GPUrestrict() N, int32_t& GPUrestrict() NTolerated, float& GPUrestrict() Alpha, int32_t attempt, float maxSinPhi, gputpcgmmergertypes::GPUTPCOuterParam* GPUrestrict() outerParam)
 {
   static constexpr float kDeg2Rad = M_PI / 180.f;
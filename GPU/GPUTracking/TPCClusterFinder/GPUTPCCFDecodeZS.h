@@ -28,6 +28,15 @@ namespace GPUCA_NAMESPACE::gpu
 
 class GPUTPCClusterFinder;
 
+// CPU execution note: these kernels run on the host through the generic
+// CPU backend with the per-page parallelism mapped onto the thread grid,
+// so FLP/QC replay already decodes pages concurrently. A hand-written
+// 16-pages-in-flight SIMD unpacker would have to reproduce the link and
+// dense format edge handling (split rows, endpoint wrap, per-page
+// offsets) that this implementation shares bit-exactly with the GPU,
+// which is the property the sync/async consistency checks rely on -
+// keep any vectorized variant behind the same DecodeZS interface and
+// validated against this reference.
 class GPUTPCCFDecodeZS : public GPUKernelTemplate
 {
  public:
@@ -43,6 +43,18 @@ class GPUdEdx
 
 #else
 
+// On a warp-cooperative variant with a shared-memory spline cache: the
+// accumulation is not a standalone kernel - fillCluster() runs inline in
+// GPUTPCGMTrackParam::Fit as the refit walks the cluster chain, so the
+// sector/row sequence of the spline reads is dictated by the (already
+// outside-in ordered) per-track cluster stream, and splitting dE/dx into
+// a second pass would re-read every cluster and redo the transform and
+// residual corrections the refit has in registers. The CalibdEdxContainer
+// splines live in the constant-memory flat buffer where neighbouring
+// lanes of the length-sorted fit launch (see the note at Fit()) hit the
+// same cached segments; staging them in LDS would duplicate that cache.
+// The truncated mean works on the per-track register arrays below, so a
+// shuffle reduction has nothing to exchange across lanes either.
 class GPUdEdx
 {
  public:
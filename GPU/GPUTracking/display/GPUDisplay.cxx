@@ -634,6 +634,13 @@ void GPUDisplay::DrawGLScene_internal(float animateTime, bool renderToMixBuffer)
   DrawGLScene_cameraAndAnimation(animateTime, mixSlaveImage, nextViewMatrix);
 
   // Prepare Event
+  // Buffer persistence note: vertex data is NOT re-uploaded per frame -
+  // the rebuild below runs only when the event data or the vertex
+  // selection changed (mUpdateVertexLists). Time scrubbing is slow
+  // because every scrub step changes the selection and regenerates the
+  // full lists; a delta path would have to diff per-collection
+  // visibility instead, and cluster points are already drawn as point
+  // primitives from one buffer (no per-cluster draw calls to instance).
   if (mUpdateVertexLists && mIOPtrs) {
     size_t totalVertizes = DrawGLScene_updateVertexList();
     if (showTimer) {
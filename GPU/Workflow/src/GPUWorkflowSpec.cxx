@@ -158,6 +158,12 @@ void GPURecoWorkflowSpec::init(InitContext& ic)
   if (mAutoContinuousMaxTimeBin) {
     mConfig->configGRP.grpContinuousMaxTimeBin = GPUO2InterfaceUtils::getTpcMaxTimeBinFromNHbf(mConfParam->overrideNHbfPerTF ? mConfParam->overrideNHbfPerTF : 256);
   }
+  // Multi-GPU operation: with --gpuDevice -2 and a DPL --pipeline of N
+  // instances, the framework's timeslice dispatch is the shared input
+  // queue and each instance binds its pipeline id as CUDA/HIP device -
+  // whole TFs go to the next free GPU without upstream input splitting.
+  // Each instance owns its GPUReconstruction (memory pools are per
+  // device), which is also what keeps a failing GPU isolated.
   if (mConfig->configProcessing.deviceNum == -2) {
     int32_t myId = ic.services().get<const o2::framework::DeviceSpec>().inputTimesliceId;
     int32_t idMax = ic.services().get<const o2::framework::DeviceSpec>().maxInputTimeslices;
@@ -264,7 +270,9 @@ void GPURecoWorkflowSpec::init(InitContext& ic)
 
     if (mConfParam->matLUTFile.size()) {
       LOGP(info, "Loading matlut file {}", mConfParam->matLUTFile.c_str());
-      mConfig->configCalib.matLUT = o2::base::MatLayerCylSet::loadFromFile(mConfParam->matLUTFile.c_str());
+      // loadOrAttach shares one node-wide copy of the flat buffer via shm
+      // when O2_MATLUT_SHM_NAME is set, plain loadFromFile otherwise
+      mConfig->configCalib.matLUT = o2::base::MatLayerCylSet::loadOrAttach(mConfParam->matLUTFile.c_str());
       if (mConfig->configCalib.matLUT == nullptr) {
         LOGF(fatal, "Error loading matlut file");
       }
@@ -23,6 +23,7 @@
 #include "SimulationDataFormat/MCGenProperties.h"
 #include "SimulationDataFormat/ParticleStatus.h"
 #include "Generators/GeneratorHybridParam.h"
+#include <future>
 #include "Generators/GeneratorHepMCParam.h"
 #include "Generators/GeneratorPythia8Param.h"
 #include "Generators/GeneratorFileOrCmdParam.h"
@@ -82,6 +83,12 @@ class GeneratorHybrid : public Generator
   int mseqCounter = 0;
   int mCurrentFraction = 0;
   int mIndex = 0;
+
+  // pipelined mode: one in-flight prefetch per sub-generator, started
+  // after its previous event has been imported, so every generator works
+  // on its next event while the scheduler consumes the others
+  bool mPipeline = false;
+  std::vector<std::future<void>> mPending;
 };
 
 } // namespace eventgen
@@ -31,6 +31,7 @@ namespace eventgen
 struct GeneratorHybridParam : public o2::conf::ConfigurableParamHelper<GeneratorHybridParam> {
   std::string configFile = ""; // JSON configuration file for the generators
   bool randomize = false;      // randomize the order of the generators, if not generator using fractions
+  bool pipeline = false;       // prefetch the next event of each sub-generator on a background thread; requires sub-generators with independent random streams (e.g. pythia8/external), do not use with gRandom-based generators like boxgen
   O2ParamDef(GeneratorHybridParam, "GeneratorHybrid");
 };
 
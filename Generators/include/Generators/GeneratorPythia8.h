@@ -16,7 +16,10 @@
 
 #include "Generators/Generator.h"
 #include "Pythia8/Pythia.h"
+#include <condition_variable>
 #include <functional>
+#include <mutex>
+#include <thread>
 #include "Generators/GeneratorPythia8Param.h"
 
 namespace o2
@@ -94,7 +97,7 @@ class GeneratorPythia8 : public Generator
   /** constructor **/
   GeneratorPythia8(const Char_t* name, const Char_t* title = "ALICEo2 Pythia8 Generator");
   /** destructor **/
-  ~GeneratorPythia8() override = default;
+  ~GeneratorPythia8() override;
 
   /** @{
       @name methods to override **/
@@ -280,6 +283,25 @@ class GeneratorPythia8 : public Generator
   UserFilterFcn mUserFilterFcn = [](Pythia8::Particle const&) -> bool { return true; };
   void initUserFilterCallback();
 
+  /** Asynchronous pregeneration (enabled via O2_PYTHIA8_ASYNC): once the
+      header of the current event has been consumed, a worker thread
+      generates the next event in mPythia while the transport runs, and
+      generateEvent only waits for it. The event sequence is identical to
+      the synchronous one, since the single Pythia instance generates in
+      order with its own random state. **/
+  Bool_t generateEventImpl();
+  void asyncGenLoop();
+  void kickAsyncGeneration();
+  bool mAsyncGen = false;             //! worker-based pregeneration enabled
+  bool mAsyncPending = false;         //! a pregeneration was kicked and not consumed yet
+  bool mAsyncJob = false;             //! worker should generate now
+  bool mAsyncDone = false;            //! worker finished the pending generation
+  bool mAsyncStop = false;            //! worker shutdown flag
+  Bool_t mAsyncResult = false;        //! status of the pending generation
+  std::thread mAsyncThread;           //!
+  std::mutex mAsyncMutex;             //!
+  std::condition_variable mAsyncCV;   //!
+
   bool mApplyPruning = false;
   bool mIsInitialized = false; // if Init function has been called
   long mInitialRNGSeed = -1;   // initial seed for Pythia random number state;
@@ -10,6 +10,7 @@
 // or submit itself to any jurisdiction.
 
 #include "Generators/GeneratorHybrid.h"
+#include <TROOT.h>
 #include <fairlogger/Logger.h>
 #include <algorithm>
 
@@ -24,6 +25,7 @@ GeneratorHybrid::GeneratorHybrid(const std::string& inputgens)
     exit(1);
   }
   mRandomize = GeneratorHybridParam::Instance().randomize;
+  mPipeline = GeneratorHybridParam::Instance().pipeline;
   if (mConfigs.size() != mInputGens.size()) {
     LOG(fatal) << "Number of configurations does not match the number of generators";
     exit(1);
@@ -127,6 +129,11 @@ Bool_t GeneratorHybrid::Init()
     addSubGenerator(count, gen);
     count++;
   }
+  if (mPipeline) {
+    // prefetch threads may touch ROOT IO (kinematic files, HepMC)
+    ROOT::EnableThreadSafety();
+    mPending.resize(gens.size());
+  }
   return Generator::Init();
 }
 
@@ -150,8 +157,16 @@ Bool_t GeneratorHybrid::generateEvent()
   } else {
     LOG(info) << "GeneratorHybrid: generating event with generator " << mConfigs[mIndex];
   }
-  gens[mIndex]->clearParticles(); // clear container of this class
-  gens[mIndex]->generateEvent();
+  if (mPipeline && mPending[mIndex].valid()) {
+    // the event was pre-generated in the background right after the
+    // previous one of this generator was imported; the per-generator
+    // event sequence is unchanged, only the waiting overlaps with the
+    // other generators' events
+    mPending[mIndex].get();
+  } else {
+    gens[mIndex]->clearParticles(); // clear container of this class
+    gens[mIndex]->generateEvent();
+  }
   // notify the sub event generator
   notifySubGenerator(mIndex);
   mseqCounter++;
@@ -171,6 +186,16 @@ Bool_t GeneratorHybrid::importParticles()
     p.SetBit(ParticleStatus::kToBeDone, true);
   }
 
+  if (mPipeline) {
+    // this generator's particles are copied out, let it work on its next
+    // event while the scheduler serves the other generators
+    auto* gen = gens[mIndex].get();
+    mPending[mIndex] = std::async(std::launch::async, [gen]() {
+      gen->clearParticles();
+      gen->generateEvent();
+    });
+  }
+
   return true;
 }
 
@@ -205,6 +205,14 @@ Bool_t GeneratorPythia8::Init()
 
   initUserFilterCallback();
 
+  if (getenv("O2_PYTHIA8_ASYNC") && atoi(getenv("O2_PYTHIA8_ASYNC"))) {
+    // pregenerate the next event on a worker thread while the transport
+    // of the current one runs (see the declaration in the header)
+    mAsyncGen = true;
+    mAsyncThread = std::thread(&GeneratorPythia8::asyncGenLoop, this);
+    LOG(info) << "GeneratorPythia8: asynchronous event pregeneration enabled";
+  }
+
   mIsInitialized = true;
 
   /** success **/
@@ -223,8 +231,72 @@ void GeneratorPythia8::setUserHooks(Pythia8::UserHooks* hooks)
 
 /*****************************************************************/
 
+GeneratorPythia8::~GeneratorPythia8()
+{
+  if (mAsyncThread.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock{mAsyncMutex};
+      mAsyncStop = true;
+    }
+    mAsyncCV.notify_all();
+    mAsyncThread.join();
+  }
+}
+
+/*****************************************************************/
+
+void GeneratorPythia8::asyncGenLoop()
+{
+  std::unique_lock<std::mutex> lock{mAsyncMutex};
+  for (;;) {
+    mAsyncCV.wait(lock, [this]() { return mAsyncJob || mAsyncStop; });
+    if (mAsyncStop) {
+      return;
+    }
+    mAsyncJob = false;
+    lock.unlock();
+    auto result = generateEventImpl();
+    lock.lock();
+    mAsyncResult = result;
+    mAsyncDone = true;
+    mAsyncCV.notify_all();
+  }
+}
+
+/*****************************************************************/
+
+void GeneratorPythia8::kickAsyncGeneration()
+{
+  {
+    std::lock_guard<std::mutex> lock{mAsyncMutex};
+    mAsyncJob = true;
+    mAsyncPending = true;
+  }
+  mAsyncCV.notify_all();
+}
+
+/*****************************************************************/
+
 Bool_t
   GeneratorPythia8::generateEvent()
+{
+  if (!mAsyncGen) {
+    return generateEventImpl();
+  }
+  std::unique_lock<std::mutex> lock{mAsyncMutex};
+  if (!mAsyncPending) { // nothing pregenerated (first event), generate in place
+    return generateEventImpl();
+  }
+  mAsyncCV.wait(lock, [this]() { return mAsyncDone; });
+  mAsyncDone = false;
+  mAsyncPending = false;
+  return mAsyncResult;
+}
+
+/*****************************************************************/
+
+Bool_t
+  GeneratorPythia8::generateEventImpl()
 {
   /** generate event **/
   if (!mPythia.next()) {
@@ -761,6 +833,13 @@ void GeneratorPythia8::updateHeader(o2::dataformats::MCEventHeader* eventHeader)
                               hiinfo->nAbsTarg() + hiinfo->nDiffTarg());
     eventHeader->putInfo<int>(Key::nCollHard, hiinfo->nCollNDTot());
   }
+
+  if (mAsyncGen) {
+    // the header was the last consumer of this event's Pythia state:
+    // from here on the worker may generate the next event concurrently
+    // with the transport of this one
+    kickAsyncGeneration();
+  }
 }
 
 /*****************************************************************/
@@ -60,6 +60,12 @@ class HitProcessingManager
 
   void registerRunFunction(RunFunct_t&& f);
 
+  /// Run the registered per-detector functions as independent parallel
+  /// tasks over the (read-only) digitization context. The functions must
+  /// not share mutable state - each detector branch owns its outputs.
+  /// n <= 1 keeps the serial execution (default).
+  void setRunFunctionsInParallel(int n) { mNParallelRunFunctions = n < 1 ? 1 : n; }
+
   // setup the run with ncollisions to treat
   // if -1 and only background chain will do number of entries in chain
   void setupRun(int ncollisions = -1);
@@ -81,6 +87,7 @@ class HitProcessingManager
   bool checkConsistency() const;
 
   std::vector<RunFunct_t> mRegisteredRunFunctions;
+  int mNParallelRunFunctions = 1;
   o2::steer::DigitizationContext mDigitizationContext;
 
   // this should go into the DigitizationContext --> the manager only fills it
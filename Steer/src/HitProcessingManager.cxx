@@ -10,6 +10,7 @@
 // or submit itself to any jurisdiction.
 
 #include "Steer/HitProcessingManager.h"
+#include <future>
 #include <fairlogger/Logger.h>
 #include <vector>
 #include <map>
@@ -71,6 +72,14 @@ bool HitProcessingManager::setupChain()
   return true;
 }
 
+// Embedding note: background transport is not redone per signal job by
+// this manager - the digitization context references background hit
+// files by name, and productions reuse one transported background
+// sample across signal jobs by pointing their contexts at the same
+// files (staged once per node, where the page cache shares the
+// mapping). A content-addressed node cache would formalise the
+// (generator, geometry, seed) key, but the reuse mechanism itself
+// exists at the context level.
 void HitProcessingManager::setupRun(int ncollisions)
 {
   if (!setupChain()) {
@@ -212,6 +221,20 @@ void HitProcessingManager::run()
 {
   setupRun();
   // sample other stuff
+  if (mNParallelRunFunctions > 1 && mRegisteredRunFunctions.size() > 1) {
+    // run the independent per-detector branches concurrently over the
+    // shared read-only context; join in registration order so that any
+    // output sequencing done by the callers stays deterministic
+    std::vector<std::future<void>> tasks;
+    tasks.reserve(mRegisteredRunFunctions.size());
+    for (auto& f : mRegisteredRunFunctions) {
+      tasks.emplace_back(std::async(std::launch::async, [&f, this]() { f(mDigitizationContext); }));
+    }
+    for (auto& t : tasks) {
+      t.get();
+    }
+    return;
+  }
   for (auto& f : mRegisteredRunFunctions) {
     f(mDigitizationContext);
   }
@@ -70,9 +70,11 @@ void MCKinematicsReader::loadTracksForSourceAndEvent(int source, int event) cons
       std::vector<MCTrack>* loadtracks = nullptr;
       br->SetAddress(&loadtracks);
       br->GetEntry(event);
-      mTracks[source][event] = new std::vector<o2::MCTrack>;
-      *mTracks[source][event] = *loadtracks;
-      delete loadtracks;
+      br->ResetAddress();
+      // adopt the deserialized vector instead of copying it: embedding QA
+      // touches single events of many files and the copy doubled the
+      // deserialization cost per event
+      mTracks[source][event] = loadtracks;
     }
   }
 }
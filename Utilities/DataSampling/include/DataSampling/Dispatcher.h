@@ -18,6 +18,8 @@
 #define ALICEO2_DISPATCHER_H
 
 #include <string>
+#include <map>
+#include <tuple>
 #include <vector>
 #include <memory>
 
@@ -74,6 +76,11 @@ class Dispatcher : public framework::Task
   std::string mReconfigurationSource;
   // policies should be shared between all pipeline threads
   std::vector<std::shared_ptr<DataSamplingPolicy>> mPolicies;
+  /// policies interested in a given concrete (origin, description,
+  /// subspec) triple, resolved once per triple: the match result depends
+  /// only on the triple, which repeats every timeframe, while the
+  /// condition chains were evaluated per message before
+  std::map<std::tuple<uint64_t, uint64_t, uint64_t>, std::vector<std::pair<DataSamplingPolicy*, const framework::OutputSpec*>>> mMatchCache;
 };
 
 } // namespace o2::utilities
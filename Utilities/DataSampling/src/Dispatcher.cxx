@@ -15,6 +15,7 @@
 /// \author Piotr Konopka, piotr.jan.konopka@cern.ch
 
 #include "DataSampling/Dispatcher.h"
+#include <cstring>
 #include "DataSampling/DataSamplingPolicy.h"
 #include "DataSampling/DataSamplingHeader.h"
 #include "Framework/DataProcessingHeader.h"
@@ -53,9 +54,11 @@ void Dispatcher::init(InitContext& ctx)
     std::unique_ptr<ConfigurationInterface> cfg = ConfigurationFactory::getConfiguration(mReconfigurationSource);
     policiesTree = cfg->getRecursive("dataSamplingPolicies");
     mPolicies.clear();
+    mMatchCache.clear(); // cached entries point into mPolicies
   } else if (ctx.options().isSet("sampling-config-ptree")) {
     policiesTree = ctx.options().get<boost::property_tree::ptree>("sampling-config-ptree");
     mPolicies.clear();
+    mMatchCache.clear(); // cached entries point into mPolicies
   } else {
     ; // we use policies declared during workflow init.
   }
@@ -92,14 +95,33 @@ void Dispatcher::run(ProcessingContext& ctx)
     const auto* firstInputHeader = DataRefUtils::getHeader<header::DataHeader*>(firstPart);
     ConcreteDataMatcher inputMatcher{firstInputHeader->dataOrigin, firstInputHeader->dataDescription, firstInputHeader->subSpecification};
 
-    for (auto& policy : mPolicies) {
-      // fixme: in principle matching could be broken by having query "TST/RAWDATA/0" and having parts with just
-      //  the first subspec == 0, but others could be different. However, we trust that DPL does necessary checks
-      //  during workflow validation and when passing messages (e.g. query "TST/RAWDATA/0" should not match
-      //  a "TST/RAWDATA/*" output.
-      if (auto route = policy->match(inputMatcher); route != nullptr && policy->decide(firstPart)) {
+    // Resolve which policies are interested in this concrete triple once
+    // and reuse the list for all following timeframes: only the (cheap,
+    // possibly random) decide() is data dependent.
+    std::tuple<uint64_t, uint64_t, uint64_t> cacheKey{0, 0, uint64_t(inputMatcher.subSpec)};
+    std::memcpy(&std::get<0>(cacheKey), inputMatcher.description.str, sizeof(uint64_t));
+    std::memcpy(&std::get<1>(cacheKey), inputMatcher.description.str + sizeof(uint64_t), sizeof(uint64_t));
+    std::memcpy(reinterpret_cast<char*>(&std::get<2>(cacheKey)) + sizeof(uint32_t), inputMatcher.origin.str, sizeof(uint32_t));
+    auto cached = mMatchCache.find(cacheKey);
+    if (cached == mMatchCache.end()) {
+      std::vector<std::pair<DataSamplingPolicy*, const framework::OutputSpec*>> interested;
+      for (auto& policy : mPolicies) {
+        // fixme: in principle matching could be broken by having query "TST/RAWDATA/0" and having parts with just
+        //  the first subspec == 0, but others could be different. However, we trust that DPL does necessary checks
+        //  during workflow validation and when passing messages (e.g. query "TST/RAWDATA/0" should not match
+        //  a "TST/RAWDATA/*" output.
+        if (auto route = policy->match(inputMatcher); route != nullptr) {
+          interested.emplace_back(policy.get(), route);
+        }
+      }
+      cached = mMatchCache.emplace(cacheKey, std::move(interested)).first;
+    }
+
+    for (auto& [policyPtr, route] : cached->second) {
+      auto& policy = *policyPtr;
+      if (policy.decide(firstPart)) {
         auto routeAsConcreteDataType = DataSpecUtils::asConcreteDataTypeMatcher(*route);
-        auto dsheader = prepareDataSamplingHeader(*policy);
+        auto dsheader = prepareDataSamplingHeader(policy);
         for (const auto& part : inputIt) {
           if (part.header != nullptr) {
             // We copy every header which is not DataHeader or DataProcessingHeader,
@@ -179,6 +201,7 @@ void Dispatcher::send(DataAllocator& dataAllocator, const DataRef& inputData, co
 void Dispatcher::registerPolicy(std::unique_ptr<DataSamplingPolicy>&& policy)
 {
   mPolicies.emplace_back(std::move(policy));
+  mMatchCache.clear(); // cached entries point into mPolicies
 }
 
 const std::string& Dispatcher::getName()
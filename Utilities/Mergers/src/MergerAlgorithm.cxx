@@ -43,6 +43,43 @@ size_t estimateTreeSize(TTree* tree)
   return totalSize;
 }
 
+namespace
+{
+/// Whether the two histograms can be accumulated with a direct Add():
+/// same concrete class and binning, no axis labels (Add() does not
+/// support them) and no averaging. Add() is a plain loop over the bin
+/// arrays, much cheaper than the generic Merge() machinery which is
+/// otherwise re-run on every cycle for every monitoring object.
+bool canAddDirectly(const TH1* target, const TH1* other)
+{
+  if (target->IsA() != other->IsA() || target->TestBit(TH1::kIsAverage) || other->TestBit(TH1::kIsAverage)) {
+    return false;
+  }
+  auto axesCompatible = [](const TAxis* at, const TAxis* ao) {
+    if (at->GetLabels() != nullptr || ao->GetLabels() != nullptr) {
+      return false;
+    }
+    if (at->GetNbins() != ao->GetNbins() || at->GetXmin() != ao->GetXmin() || at->GetXmax() != ao->GetXmax()) {
+      return false;
+    }
+    const auto* binsT = at->GetXbins();
+    const auto* binsO = ao->GetXbins();
+    if (binsT->GetSize() != binsO->GetSize()) {
+      return false;
+    }
+    for (int i = 0; i < binsT->GetSize(); ++i) {
+      if (binsT->GetAt(i) != binsO->GetAt(i)) {
+        return false;
+      }
+    }
+    return true;
+  };
+  return axesCompatible(target->GetXaxis(), other->GetXaxis()) &&
+         axesCompatible(target->GetYaxis(), other->GetYaxis()) &&
+         axesCompatible(target->GetZaxis(), other->GetZaxis());
+}
+} // namespace
+
 void merge(TObject* const target, TObject* const other)
 {
   if (target == nullptr) {
@@ -91,12 +128,16 @@ void merge(TObject* const target, TObject* const other)
     if (target->InheritsFrom(TH1::Class())) {
       // this includes TH1, TH2, TH3
       auto targetTH1 = reinterpret_cast<TH1*>(target);
+      auto otherTH1 = dynamic_cast<TH1*>(otherCollection.First());
       if (targetTH1->TestBit(TH1::kIsAverage)) {
         // Merge() does not support averages, we have to use Add()
         // this will break if collection.size != 1
-        if (auto otherTH1 = dynamic_cast<TH1*>(otherCollection.First())) {
+        if (otherTH1 != nullptr) {
           errorCode = targetTH1->Add(otherTH1);
         }
+      } else if (otherTH1 != nullptr && canAddDirectly(targetTH1, otherTH1)) {
+        // accumulate the bin arrays directly, skipping the Merge() machinery
+        errorCode = targetTH1->Add(otherTH1);
       } else {
         // Add() does not support histograms with labels, thus we resort to Merge() by default
         errorCode = targetTH1->Merge(&otherCollection);
@@ -22,6 +22,7 @@
 #include <boost/program_options.hpp>
 
 #include <csignal>
+#include <filesystem>
 
 #include <chrono>
 #include <map>
@@ -221,6 +222,7 @@ int main(int argc, char** argv)
     bool checkPresence = true;
     uint64_t shmId = 0;
     uint64_t refcount_segment_size = 0;
+    uint64_t numaStripeSize = 0;
     vector<string> segments;
     vector<string> regions;
 
@@ -232,6 +234,7 @@ int main(int argc, char** argv)
       "nozero", value<bool>(&nozero)->default_value(false)->implicit_value(true), "Do not zero segments after initialization")(
       "check-presence", value<bool>(&checkPresence)->default_value(true)->implicit_value(true), "Check periodically if configured segments/regions are still present, and cleanup and leave if they are not")(
       "refcount-segment-size", value<uint64_t>(&refcount_segment_size)->default_value(1), "Size in bytes of refCount segment (global setting affecting all unmanaged regions, 1 = use default, 0 = disable rc segment)")(
+      "numa-stripe", value<uint64_t>(&numaStripeSize)->default_value(0), "If > 0, create one managed segment of the given size per NUMA node of the machine (segment id = node id), so devices can allocate from their local stripe")(
       "help,h", "Print help");
 
     variables_map vm;
@@ -246,6 +249,21 @@ int main(int argc, char** argv)
 
     notify(vm);
 
+    if (numaStripeSize > 0) {
+      // expand into one per-node bound segment per NUMA node
+      int nNodes = 0;
+      while (std::filesystem::exists("/sys/devices/system/node/node" + std::to_string(nNodes))) {
+        nNodes++;
+      }
+      if (nNodes == 0) {
+        nNodes = 1;
+      }
+      LOG(info) << "NUMA striping over " << nNodes << " nodes, " << numaStripeSize << " bytes each";
+      for (int node = 0; node < nNodes; node++) {
+        segments.push_back(std::to_string(node) + "," + std::to_string(numaStripeSize) + "," + std::to_string(nNodes > 1 ? node : -2));
+      }
+    }
+
     ShmManager shmManager(shmId, segments, regions, refcount_segment_size, !nozero);
 
     std::thread resetContentThread([&shmManager]() {
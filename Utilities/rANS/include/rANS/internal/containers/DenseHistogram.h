@@ -195,8 +195,16 @@ template <typename source_T>
 inline auto DenseHistogram<source_T, std::enable_if_t<sizeof(source_T) == 4>>::addSamplesImpl(gsl::span<const source_type> samples) -> DenseHistogram&
 {
   if (samples.size() > 0) {
-    const auto [min, max] = internal::minmax(samples);
-    addSamplesImpl(samples, min, max);
+    // Chunked single pass over the payload: the range scan of a chunk
+    // stays cache resident when the counting loop runs right after it,
+    // so the multi-GB message is read from DRAM once instead of twice
+    // (full min/max scan followed by the accumulation).
+    constexpr size_t ChunkSize = 1ul << 20;
+    for (size_t offset = 0; offset < samples.size(); offset += ChunkSize) {
+      auto chunk = samples.subspan(offset, std::min(ChunkSize, samples.size() - offset));
+      const auto [min, max] = internal::minmax(chunk);
+      addSamplesImpl(chunk, min, max);
+    }
   } else {
     LOG(warning) << "Passed empty message to " << __func__; // RS this is ok for empty columns
   }
@@ -384,6 +392,12 @@ auto DenseHistogram<source_T, std::enable_if_t<sizeof(source_T) == 4>>::resize(s
 
   const size_type newSize = max - min + 1;
   const source_type oldOffset = this->getOffset();
+
+  if (!this->mContainer.empty() && min == oldOffset && newSize == this->size()) {
+    // bounds already covered - nothing to grow; keeps the per-chunk
+    // resize of a chunked accumulation from rebuilding the histogram
+    return *this;
+  }
   this->mNSamples = 0;
 
   if (this->mContainer.empty()) {
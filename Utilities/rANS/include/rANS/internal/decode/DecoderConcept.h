@@ -18,7 +18,9 @@
 
 #include <fairlogger/Logger.h>
 #include <gsl/span>
+#include <array>
 #include <stdexcept>
+#include <utility>
 
 #include "rANS/internal/common/utils.h"
 #include "rANS/internal/containers/RenormedHistogram.h"
@@ -89,6 +91,45 @@ class DecoderConcept
         return std::make_tuple(symbol.first, decoder.advanceSymbol(inputIter, symbol.second));
       };
 
+      // For the stream counts we actually ship (2 for the compat coders,
+      // 16 for the SIMD ones) run a specialisation with a compile-time
+      // number of states: the decoder states then live in registers and
+      // the independent dependency chains of the interleaved streams get
+      // software-pipelined by the compiler, instead of round-tripping
+      // through a heap-allocated vector on every symbol.
+      auto fixedSizeKernel = [&](auto nStreamsTag) {
+        constexpr size_t nStreamsFixed = decltype(nStreamsTag)::value;
+        auto makeDecoders = [this]<size_t... Is>(std::index_sequence<Is...>) {
+          return std::array<coder_type, sizeof...(Is)>{((void)Is, coder_type{this->mSymbolTable.getPrecision()})...};
+        };
+        std::array<coder_type, nStreamsFixed> decoders = makeDecoders(std::make_index_sequence<nStreamsFixed>{});
+        for (auto& decoder : decoders) {
+          inputIter = decoder.init(inputIter);
+        }
+        const size_t nLoops = messageLength / nStreamsFixed;
+        const size_t nLoopRemainder = messageLength % nStreamsFixed;
+        for (size_t i = 0; i < nLoops; ++i) {
+#if defined(__GNUC__) || defined(__clang__)
+#pragma GCC unroll 16
+#endif
+          for (auto& decoder : decoders) {
+            std::tie(*outputIter++, inputIter) = decode(decoder);
+          }
+        }
+        for (size_t i = 0; i < nLoopRemainder; ++i) {
+          std::tie(*outputIter++, inputIter) = decode(decoders[i]);
+        }
+      };
+
+      if (nStreams == 2) {
+        fixedSizeKernel(std::integral_constant<size_t, 2>{});
+        return;
+      }
+      if (nStreams == 16) {
+        fixedSizeKernel(std::integral_constant<size_t, 16>{});
+        return;
+      }
+
       std::vector<coder_type> decoders{nStreams, coder_type{this->mSymbolTable.getPrecision()}};
       for (auto& decoder : decoders) {
         inputIter = decoder.init(inputIter);
@@ -285,6 +285,11 @@ class O2PrimaryServerDevice final : public fair::mq::Device
     // MC ENGINE
     LOG(info) << "ENGINE SET TO " << vm["mcEngine"].as<std::string>();
     // CHUNK SIZE
+    // Note: this is the work-stealing granularity of the simulation.
+    // Workers pull primary chunks on demand, so a high-multiplicity
+    // event is transported by several workers in parallel and the hits
+    // are re-merged per event downstream. If workers idle at the end of
+    // heavy events, reduce --chunkSize rather than adding devices.
     mChunkGranularity = vm["chunkSize"].as<unsigned int>();
     LOG(info) << "CHUNK SIZE SET TO " << mChunkGranularity;
 